@@ -0,0 +1,39 @@
+#!/bin/bash
+echo "=== Task 23: 64-bit Clocksource and Time Conversion ==="
+
+ARCH="-march=rv32imac_zicsr -mabi=ilp32"
+
+# Compile all components
+echo "1. Compiling clocksource demo components..."
+riscv32-unknown-elf-gcc $ARCH -c printf_start.s -o printf_start.o
+riscv32-unknown-elf-gcc $ARCH -O2 -c clocksource.c -o clocksource.o
+riscv32-unknown-elf-gcc $ARCH -O2 -c task23_clocksource.c -o task23_clocksource.o
+riscv32-unknown-elf-gcc $ARCH -c syscalls.c -o syscalls.o -nostdlib
+riscv32-unknown-elf-gcc $ARCH -c uart_rx.c -o uart_rx.o -nostdlib
+
+# The conversion path must not need libgcc's 64-bit division
+echo "2. Checking clocksource.o is division-free..."
+if riscv32-unknown-elf-nm clocksource.o | grep -E "__(u)?(div|mod)di3"; then
+    echo "ERROR: clocksource.o calls a libgcc 64-bit division helper"
+    exit 1
+fi
+
+# Link program
+echo "3. Linking clocksource demo..."
+riscv32-unknown-elf-gcc -T virt.ld $ARCH -nostartfiles printf_start.o task23_clocksource.o clocksource.o syscalls.o uart_rx.o -o task23_clocksource.elf
+
+echo "✓ Compilation successful!"
+
+# Verify results
+echo -e "\n4. Verifying clocksource demo:"
+file task23_clocksource.elf
+
+echo -e "\n5. hi/lo/hi retry loop in mtime_read():"
+riscv32-unknown-elf-objdump -d task23_clocksource.elf | sed -n '/<bench_mtime_read>:/,/ret/p'
+
+echo -e "\n6. mult/shift conversion vs __udivdi3 call:"
+riscv32-unknown-elf-objdump -d task23_clocksource.elf | sed -n '/<bench_convert_mult_shift>:/,/ret/p' | grep -E "\smulhu?\s"
+riscv32-unknown-elf-objdump -d task23_clocksource.elf | sed -n '/<bench_convert_divide>:/,/ret/p' | grep "__udivdi3"
+
+echo -e "\n✓ Clocksource demo ready!"
+echo "Run: qemu-system-riscv32 -M virt -nographic -bios none -kernel task23_clocksource.elf"
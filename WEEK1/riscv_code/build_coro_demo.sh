@@ -0,0 +1,33 @@
+#!/bin/bash
+echo "=== Task 26: Stackless Coroutines ==="
+
+ARCH="-march=rv32imac_zicsr -mabi=ilp32"
+CFLAGS="-O2 -ffreestanding -fno-tree-loop-distribute-patterns"   # No hidden memset calls
+
+# Compile all components (no newlib: 16K of SRAM, no heap)
+echo "1. Compiling coroutine demo components..."
+riscv32-unknown-elf-gcc $ARCH -c trap_start.s -o trap_start.o
+riscv32-unknown-elf-gcc $ARCH -c context_switch.s -o context_switch.o
+riscv32-unknown-elf-gcc $ARCH $CFLAGS -c clocksource.c -o clocksource.o
+riscv32-unknown-elf-gcc $ARCH $CFLAGS -c coro.c -o coro.o
+riscv32-unknown-elf-gcc $ARCH $CFLAGS -c task26_coro.c -o task26_coro.o
+
+# Link program: code in flash, data/BSS/stack in the 16K SRAM
+echo "2. Linking coroutine demo..."
+riscv32-unknown-elf-gcc -T sifive_e.ld $ARCH -nostartfiles -nostdlib trap_start.o context_switch.o clocksource.o coro.o task26_coro.o -lgcc -o task26_coro.elf
+
+echo "✓ Compilation successful!"
+
+# Verify results
+echo -e "\n3. Verifying coroutine demo:"
+file task26_coro.elf
+riscv32-unknown-elf-size task26_coro.elf
+
+echo -e "\n4. RAM used by the tasks vs the threaded baseline's stack:"
+riscv32-unknown-elf-nm -S --size-sort task26_coro.elf | grep -E " (red|green|pulser|watcher|console|supervisor|thread_stack)$"
+
+echo -e "\n5. Event loop sleep (wfi with MIE masked):"
+riscv32-unknown-elf-objdump -d task26_coro.elf | sed -n '/<coro_run>:/,/^$/p' | grep -E "wfi|csrc|csrs"
+
+echo -e "\n✓ Coroutine demo ready!"
+echo "Run: qemu-system-riscv32 -M sifive_e -nographic -kernel task26_coro.elf"
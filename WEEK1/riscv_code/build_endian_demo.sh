@@ -7,11 +7,12 @@ riscv32-unknown-elf-gcc -march=rv32imafd -mabi=ilp32d -c endian_start.s -o endia
 riscv32-unknown-elf-gcc -march=rv32imafd -mabi=ilp32d -c task17_endianness.c -o task17_endianness.o
 riscv32-unknown-elf-gcc -march=rv32imafd -mabi=ilp32d -c task17_simple_endian.c -o task17_simple_endian.o
 riscv32-unknown-elf-gcc -march=rv32imafd -mabi=ilp32d -c endian_printf.c -o endian_printf.o
+riscv32-unknown-elf-gcc -march=rv32imafd_zicsr -mabi=ilp32d -c uart_rx.c -o uart_rx.o
 
 # Link programs
 echo "2. Linking endianness programs..."
-riscv32-unknown-elf-gcc -T endian.ld -march=rv32imafd -mabi=ilp32d -nostartfiles endian_start.o task17_endianness.o endian_printf.o -o task17_endianness.elf
-riscv32-unknown-elf-gcc -T endian.ld -march=rv32imafd -mabi=ilp32d -nostartfiles endian_start.o task17_simple_endian.o endian_printf.o -o task17_simple_endian.elf
+riscv32-unknown-elf-gcc -T endian.ld -march=rv32imafd -mabi=ilp32d -nostartfiles endian_start.o task17_endianness.o endian_printf.o uart_rx.o -o task17_endianness.elf
+riscv32-unknown-elf-gcc -T endian.ld -march=rv32imafd -mabi=ilp32d -nostartfiles endian_start.o task17_simple_endian.o endian_printf.o uart_rx.o -o task17_simple_endian.elf
 
 echo "✓ Compilation successful!"
 
@@ -0,0 +1,38 @@
+#!/bin/bash
+echo "=== Task 19: Endian & Serialization Library ==="
+
+ARCH="-march=rv32imac_zicsr -mabi=ilp32"
+
+# Compile all components
+echo "1. Compiling endian library benchmark (with and without Zbb)..."
+riscv32-unknown-elf-gcc $ARCH -c printf_start.s -o printf_start.o
+riscv32-unknown-elf-gcc $ARCH -c syscalls.c -o syscalls.o -nostdlib
+riscv32-unknown-elf-gcc $ARCH -c uart_rx.c -o uart_rx.o -nostdlib
+riscv32-unknown-elf-gcc $ARCH -O2 -c task19_endian_bench.c -o task19_endian_bench.o
+riscv32-unknown-elf-gcc -march=rv32imac_zicsr_zbb -mabi=ilp32 -O2 -c task19_endian_bench.c -o task19_endian_bench_zbb.o
+
+# Link programs
+echo "2. Linking benchmark programs..."
+riscv32-unknown-elf-gcc -T virt.ld $ARCH -nostartfiles printf_start.o task19_endian_bench.o syscalls.o uart_rx.o -o task19_endian_bench.elf
+riscv32-unknown-elf-gcc -T virt.ld $ARCH -nostartfiles printf_start.o task19_endian_bench_zbb.o syscalls.o uart_rx.o -o task19_endian_bench_zbb.elf
+
+echo "✓ Compilation successful!"
+
+# Verify results
+echo -e "\n3. Verifying benchmark programs:"
+file task19_endian_bench.elf
+file task19_endian_bench_zbb.elf
+
+echo -e "\n4. Byte swap in aligned BE loop (fallback vs rev8):"
+riscv32-unknown-elf-objdump -d task19_endian_bench.elf | grep -A 16 "<sum_be_words_aligned>:"
+riscv32-unknown-elf-objdump -d task19_endian_bench_zbb.elf | grep -A 10 "<sum_be_words_aligned>:"
+
+echo -e "\n5. rev8 instruction count in Zbb build:"
+riscv32-unknown-elf-objdump -d task19_endian_bench_zbb.elf | grep -c "rev8"
+
+echo -e "\n6. Branches inside the wire decoder loop (should be the loop branch only):"
+riscv32-unknown-elf-objdump -d task19_endian_bench.elf | sed -n '/<sum_decode_le>:/,/ret/p' | grep -E "\sb[a-z]+\s"
+
+echo -e "\n✓ Endian library benchmark ready!"
+echo "Run: qemu-system-riscv32 -M virt -nographic -bios none -kernel task19_endian_bench.elf"
+echo "     qemu-system-riscv32 -M virt -cpu rv32,zbb=true -nographic -bios none -kernel task19_endian_bench_zbb.elf"
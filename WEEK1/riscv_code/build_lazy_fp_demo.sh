@@ -0,0 +1,41 @@
+#!/bin/bash
+echo "=== Task 18: Lazy FP Context Switching ==="
+
+ARCH="-march=rv32imafd_zicsr -mabi=ilp32d"
+
+# Compile all components
+echo "1. Compiling lazy FP demo components..."
+riscv32-unknown-elf-gcc $ARCH -c fp_start.s -o fp_start.o
+riscv32-unknown-elf-gcc $ARCH -c fp_context.s -o fp_context.o
+riscv32-unknown-elf-gcc $ARCH -c context_switch.s -o context_switch.o
+riscv32-unknown-elf-gcc $ARCH -O2 -c fp_sched.c -o fp_sched.o
+riscv32-unknown-elf-gcc $ARCH -O2 -c task18_lazy_fp.c -o task18_lazy_fp.o
+riscv32-unknown-elf-gcc $ARCH -c syscalls.c -o syscalls.o -nostdlib
+riscv32-unknown-elf-gcc $ARCH -c uart_rx.c -o uart_rx.o -nostdlib
+
+# The scheduler/trap code must never touch the FPU (it runs with FS = Off)
+echo "2. Checking fp_sched.o is integer-only..."
+if riscv32-unknown-elf-objdump -d fp_sched.o | grep -P "\tf(?!ence)[a-z.]+\t"; then
+    echo "ERROR: FP instructions found in fp_sched.o"
+    exit 1
+fi
+echo "✓ No FP instructions in trap/scheduler code"
+
+# Link program
+echo "3. Linking lazy FP demo..."
+riscv32-unknown-elf-gcc -T virt.ld $ARCH -nostartfiles fp_start.o fp_context.o context_switch.o fp_sched.o task18_lazy_fp.o syscalls.o uart_rx.o -o task18_lazy_fp.elf
+
+echo "✓ Compilation successful!"
+
+# Verify results
+echo -e "\n4. Verifying lazy FP demo program:"
+file task18_lazy_fp.elf
+
+echo -e "\n5. Trap entry points and FP save/restore:"
+riscv32-unknown-elf-nm task18_lazy_fp.elf | grep -E "(trap_entry|fp_context|context_switch|trap_dispatch)"
+
+echo -e "\n6. mstatus.FS manipulation in thread_yield:"
+riscv32-unknown-elf-objdump -d task18_lazy_fp.elf | grep -A 40 "<thread_yield>:" | grep -E "csr[rsc]"
+
+echo -e "\n✓ Lazy FP demo ready!"
+echo "Run: qemu-system-riscv32 -M virt -nographic -bios none -kernel task18_lazy_fp.elf"
@@ -4,13 +4,16 @@ echo "=== Task 12: Bare-Metal LED Blink Build ==="
 # Clean previous builds
 rm -f *.o *.elf
 
-# Compile assembly startup
+ARCH="-march=rv32imc_zicsr -mabi=ilp32"
+
+# Compile assembly startup (painted, guarded stacks as in TASK28)
 echo "1. Compiling startup assembly..."
-riscv32-unknown-elf-gcc -c led_start.s -o led_start.o -march=rv32imc -mabi=ilp32
+riscv32-unknown-elf-gcc -c stack_start.s -o stack_start.o $ARCH
 
 # Compile C program with correct architecture
 echo "2. Compiling LED blink program..."
-riscv32-unknown-elf-gcc -c led_blink.c -o led_blink.o -O2 -march=rv32imc -mabi=ilp32 -nostdlib
+riscv32-unknown-elf-gcc -c led_blink.c -o led_blink.o -O2 $ARCH -nostdlib
+riscv32-unknown-elf-gcc -c stack.c -o stack.o -O2 -ffreestanding -fno-tree-loop-distribute-patterns $ARCH -nostdlib
 
 # Check if compilation succeeded
 if [ ! -f led_blink.o ]; then
@@ -20,7 +23,7 @@ fi
 
 # Link with custom linker script
 echo "3. Linking with custom memory layout..."
-riscv32-unknown-elf-ld -T led_blink.ld led_start.o led_blink.o -o led_blink.elf
+riscv32-unknown-elf-ld -T led_blink.ld stack_start.o led_blink.o stack.o -o led_blink.elf
 
 # Check if linking succeeded
 if [ ! -f led_blink.elf ]; then
@@ -33,7 +36,7 @@ echo "4. Verifying build results..."
 file led_blink.elf
 
 echo -e "\n5. Memory layout verification:"
-riscv32-unknown-elf-objdump -h led_blink.elf | grep -E "\.(text|data|bss)"
+riscv32-unknown-elf-objdump -h led_blink.elf | grep -E "\.(text|data|bss|stack)"
 
 echo -e "\n6. Symbol table (first 15 entries):"
 riscv32-unknown-elf-nm led_blink.elf | head -15
@@ -0,0 +1,31 @@
+#!/bin/bash
+echo "=== Task 24: Nested Priority-Preemptive Interrupts ==="
+
+ARCH="-march=rv32imac_zicsr -mabi=ilp32"
+
+# Compile all components
+echo "1. Compiling nested interrupt demo components..."
+riscv32-unknown-elf-gcc $ARCH -c trap_start.s -o trap_start.o
+riscv32-unknown-elf-gcc $ARCH -O2 -c irq_nest.c -o irq_nest.o
+riscv32-unknown-elf-gcc $ARCH -O2 -c task24_nested_irq.c -o task24_nested_irq.o
+riscv32-unknown-elf-gcc $ARCH -c syscalls.c -o syscalls.o -nostdlib
+riscv32-unknown-elf-gcc $ARCH -O2 -c uart_rx.c -o uart_rx.o
+
+# Link program
+echo "2. Linking nested interrupt demo..."
+riscv32-unknown-elf-gcc -T virt.ld $ARCH -nostartfiles trap_start.o task24_nested_irq.o irq_nest.o syscalls.o uart_rx.o -o task24_nested_irq.elf
+
+echo "✓ Compilation successful!"
+
+# Verify results
+echo -e "\n3. Verifying nested interrupt demo:"
+file task24_nested_irq.elf
+
+echo -e "\n4. Dispatcher: save mepc/mstatus, raise threshold, re-enable MIE, unwind:"
+riscv32-unknown-elf-objdump -d task24_nested_irq.elf | sed -n '/<irq_external_dispatch>:/,/mret\|^$/p' | grep -E "csr|mepc|mstatus"
+
+echo -e "\n5. Handler table:"
+riscv32-unknown-elf-nm -S task24_nested_irq.elf | grep -E " (handlers|priorities)$"
+
+echo -e "\n✓ Nested interrupt demo ready!"
+echo "Run: qemu-system-riscv32 -M virt -nographic -bios none -kernel task24_nested_irq.elf"
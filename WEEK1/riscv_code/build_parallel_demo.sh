@@ -0,0 +1,38 @@
+#!/bin/bash
+echo "=== Task 27: Work-Stealing parallel_for Across Harts ==="
+
+ARCH="-march=rv32imac_zicsr -mabi=ilp32"
+
+# Compile all components
+echo "1. Compiling parallel runtime components..."
+riscv32-unknown-elf-gcc $ARCH -c smp_start.s -o smp_start.o
+riscv32-unknown-elf-gcc $ARCH -O2 -c smp.c -o smp.o
+riscv32-unknown-elf-gcc $ARCH -O2 -c stack.c -o stack.o
+riscv32-unknown-elf-gcc $ARCH -O2 -c wsdeque.c -o wsdeque.o
+riscv32-unknown-elf-gcc $ARCH -O2 -c parallel.c -o parallel.o
+riscv32-unknown-elf-gcc $ARCH -O2 -c clocksource.c -o clocksource.o
+riscv32-unknown-elf-gcc $ARCH -O2 -c task27_parallel.c -o task27_parallel.o
+riscv32-unknown-elf-gcc $ARCH -c syscalls.c -o syscalls.o -nostdlib
+riscv32-unknown-elf-gcc $ARCH -O2 -c uart_rx.c -o uart_rx.o
+
+# Link program (smp_start.s replaces trap_start.s: every hart enters _start)
+echo "2. Linking parallel demo..."
+riscv32-unknown-elf-gcc -T virt.ld $ARCH -nostartfiles smp_start.o smp.o stack.o wsdeque.o parallel.o clocksource.o task27_parallel.o syscalls.o uart_rx.o -o task27_parallel.elf
+
+echo "✓ Compilation successful!"
+
+# Verify results
+echo -e "\n3. Verifying parallel demo:"
+file task27_parallel.elf
+
+echo -e "\n4. Steal path (one CAS on top via lr/sc):"
+riscv32-unknown-elf-objdump -d task27_parallel.elf | sed -n '/<wsdeque_steal>:/,/^$/p' | grep -E "lr\.w|sc\.w|fence"
+
+echo -e "\n5. Owner pop (fence, CAS only for the last item):"
+riscv32-unknown-elf-objdump -d task27_parallel.elf | sed -n '/<wsdeque_pop>:/,/^$/p' | grep -E "lr\.w|sc\.w|fence"
+
+echo -e "\n✓ Parallel demo ready!"
+echo "Run (1 to 8 harts):"
+for n in 1 2 4 8; do
+    echo "  qemu-system-riscv32 -M virt -smp $n -accel tcg,thread=multi -nographic -bios none -kernel task27_parallel.elf"
+done
@@ -6,10 +6,11 @@ echo "1. Compiling printf demo components..."
 riscv32-unknown-elf-gcc -march=rv32imafd -mabi=ilp32d -c printf_start.s -o printf_start.o
 riscv32-unknown-elf-gcc -march=rv32imafd -mabi=ilp32d -c task16_uart_printf.c -o task16_uart_printf.o -nostdlib
 riscv32-unknown-elf-gcc -march=rv32imafd -mabi=ilp32d -c syscalls.c -o syscalls.o -nostdlib
+riscv32-unknown-elf-gcc -march=rv32imafd_zicsr -mabi=ilp32d -c uart_rx.c -o uart_rx.o -nostdlib
 
 # Link with Newlib using full architecture
 echo "2. Linking with Newlib..."
-riscv32-unknown-elf-gcc -T printf.ld -march=rv32imafd -mabi=ilp32d -nostartfiles printf_start.o task16_uart_printf.o syscalls.o -o task16_uart_printf.elf
+riscv32-unknown-elf-gcc -T printf.ld -march=rv32imafd -mabi=ilp32d -nostartfiles printf_start.o task16_uart_printf.o syscalls.o uart_rx.o -o task16_uart_printf.elf
 
 echo "✓ Compilation successful!"
 
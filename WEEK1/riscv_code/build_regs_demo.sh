@@ -0,0 +1,48 @@
+#!/bin/bash
+echo "=== Task 29: Typed Register Layer ==="
+
+ARCH="-march=rv32imac_zicsr -mabi=ilp32"
+CFLAGS="-O2 -ffreestanding -fno-tree-loop-distribute-patterns"   # No hidden memset calls
+
+# Compile all components
+echo "1. Compiling register layer demo..."
+riscv32-unknown-elf-gcc $ARCH -c trap_start.s -o trap_start.o
+riscv32-unknown-elf-gcc $ARCH $CFLAGS -c task29_regs.c -o task29_regs.o || exit 1
+
+# Link program: code in flash, data/BSS/stack in the 16K SRAM
+echo "2. Linking register layer demo..."
+riscv32-unknown-elf-gcc -T sifive_e.ld $ARCH -nostartfiles -nostdlib trap_start.o task29_regs.o -lgcc -o task29_regs.elf || exit 1
+
+echo "✓ Compilation successful!"
+
+# Instructions (and loads/stores) in a function's disassembly
+count_insns() {
+    local body
+    body=$(riscv32-unknown-elf-objdump -d --no-show-raw-insn task29_regs.elf | sed -n "/<$1>:/,/^$/p" | grep -E "^ +[0-9a-f]+:")
+    printf "%-20s %6d %6d %7d\n" "$1" \
+        "$(echo "$body" | wc -l)" \
+        "$(echo "$body" | grep -cE "\s(lw|lbu|lb|c\.lw)\s")" \
+        "$(echo "$body" | grep -cE "\s(sw|sb|c\.sw)\s")"
+}
+
+echo -e "\n3. Generated code, before (raw macros) and after (reg.h):"
+printf "%-20s %6s %6s %7s\n" "function" "insns" "loads" "stores"
+for f in gpio_init_raw gpio_init_typed uart_init_raw uart_init_typed \
+         uart_putc_raw uart_putc_typed ns16550_putc_raw ns16550_putc_typed; do
+    count_insns $f
+done
+riscv32-unknown-elf-objdump -d task29_regs.elf | sed -n '/<gpio_init_typed>:/,/^$/p'
+
+# Each snippet must fail to compile
+echo -e "\n4. Misuse rejected at compile time:"
+for n in 1 2 3 4 5 6 7; do
+    err=$(riscv32-unknown-elf-gcc $ARCH $CFLAGS -fsyntax-only -DREG_MISUSE_TEST=$n task29_regs.c 2>&1)
+    if [ $? -eq 0 ]; then
+        echo "  case $n: COMPILED (should have been rejected)"
+    else
+        echo "  case $n: $(echo "$err" | grep -m1 "error:" | sed 's/.*error: //')"
+    fi
+done
+
+echo -e "\n✓ Register layer demo ready!"
+echo "Run: qemu-system-riscv32 -M sifive_e -nographic -kernel task29_regs.elf"
@@ -0,0 +1,44 @@
+#!/bin/bash
+echo "=== Task 21: S-mode Runtime on OpenSBI ==="
+
+ARCH="-march=rv32imac_zicsr -mabi=ilp32"
+SMODE="-DRUNTIME_SMODE -DCONSOLE_SBI"
+
+# M-mode build: direct CLINT/UART access, no firmware
+echo "1. Compiling M-mode runtime (direct MMIO)..."
+riscv32-unknown-elf-gcc $ARCH -c trap_start.s -o trap_start.o
+riscv32-unknown-elf-gcc $ARCH -O2 -c runtime.c -o runtime_m.o
+riscv32-unknown-elf-gcc $ARCH -O2 -c task21_sbi_cost.c -o task21_sbi_cost_m.o
+riscv32-unknown-elf-gcc $ARCH -c syscalls.c -o syscalls.o -nostdlib
+riscv32-unknown-elf-gcc $ARCH -O2 -c uart_rx.c -o uart_rx.o
+riscv32-unknown-elf-gcc -T virt.ld $ARCH -nostartfiles trap_start.o task21_sbi_cost_m.o runtime_m.o syscalls.o uart_rx.o -o task21_sbi_cost_m.elf
+
+# S-mode build: payload for OpenSBI fw_dynamic, SBI console/timer/IPI
+echo "2. Compiling S-mode runtime (SBI calls)..."
+riscv32-unknown-elf-gcc $ARCH -c sbi_start.s -o sbi_start.o
+riscv32-unknown-elf-gcc $ARCH $SMODE -O2 -c runtime.c -o runtime_s.o
+riscv32-unknown-elf-gcc $ARCH $SMODE -O2 -c sbi.c -o sbi.o
+riscv32-unknown-elf-gcc $ARCH $SMODE -O2 -c task21_sbi_cost.c -o task21_sbi_cost_s.o
+riscv32-unknown-elf-gcc $ARCH $SMODE -c syscalls.c -o syscalls_sbi.o -nostdlib
+riscv32-unknown-elf-gcc -T sbi.ld $ARCH -nostartfiles sbi_start.o task21_sbi_cost_s.o runtime_s.o sbi.o syscalls_sbi.o -o task21_sbi_cost_s.elf
+
+echo "✓ Compilation successful!"
+
+# Verify results
+echo -e "\n3. Verifying both images:"
+file task21_sbi_cost_m.elf task21_sbi_cost_s.elf
+
+echo -e "\n4. Entry points (M-mode at DRAM base, S-mode at the OpenSBI payload address):"
+riscv32-unknown-elf-nm task21_sbi_cost_m.elf | grep " _start$"
+riscv32-unknown-elf-nm task21_sbi_cost_s.elf | grep " _start$"
+
+echo -e "\n5. ecall sites in the S-mode image:"
+riscv32-unknown-elf-objdump -d task21_sbi_cost_s.elf | grep -c "ecall"
+
+echo -e "\n6. Trap return instructions:"
+riscv32-unknown-elf-objdump -d task21_sbi_cost_m.elf | grep -E "\smret"
+riscv32-unknown-elf-objdump -d task21_sbi_cost_s.elf | grep -E "\ssret"
+
+echo -e "\n✓ Runtime demo ready!"
+echo "Run M-mode: qemu-system-riscv32 -M virt -nographic -bios none -kernel task21_sbi_cost_m.elf"
+echo "Run S-mode: qemu-system-riscv32 -M virt -nographic -bios opensbi-riscv32-generic-fw_dynamic.bin -kernel task21_sbi_cost_s.elf"
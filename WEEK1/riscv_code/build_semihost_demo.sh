@@ -0,0 +1,31 @@
+#!/bin/bash
+echo "=== Task 22: Semihosting Fast I/O ==="
+
+ARCH="-march=rv32imac_zicsr -mabi=ilp32"
+
+# Compile all components
+echo "1. Compiling semihosting demo components..."
+riscv32-unknown-elf-gcc $ARCH -c printf_start.s -o printf_start.o
+riscv32-unknown-elf-gcc $ARCH -O2 -c semihost.c -o semihost.o
+riscv32-unknown-elf-gcc $ARCH -DCONSOLE_SEMIHOST -c syscalls.c -o syscalls_semihost.o -nostdlib
+riscv32-unknown-elf-gcc $ARCH -c uart_rx.c -o uart_rx.o -nostdlib
+riscv32-unknown-elf-gcc $ARCH -O2 -c task22_semihost.c -o task22_semihost.o
+
+# Link program
+echo "2. Linking semihosting demo..."
+riscv32-unknown-elf-gcc -T virt.ld $ARCH -nostartfiles printf_start.o task22_semihost.o semihost.o syscalls_semihost.o uart_rx.o -o task22_semihost.elf
+
+echo "✓ Compilation successful!"
+
+# Verify results
+echo -e "\n3. Verifying semihosting demo:"
+file task22_semihost.elf
+
+echo -e "\n4. Semihosting trap sequence (must be uncompressed slli/ebreak/srai):"
+riscv32-unknown-elf-objdump -d task22_semihost.elf | grep -B 1 -A 1 "ebreak"
+
+echo -e "\n5. Syscall layer routed to semihosting:"
+riscv32-unknown-elf-nm task22_semihost.elf | grep -E " (_write|_read|_open|_close|_exit|sh_[a-z0-9]+)$"
+
+echo -e "\n✓ Semihosting demo ready!"
+echo "Run: qemu-system-riscv32 -M virt -nographic -bios none -semihosting-config enable=on,target=native -kernel task22_semihost.elf; echo \"exit status \$?\""
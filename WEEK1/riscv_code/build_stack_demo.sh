@@ -0,0 +1,41 @@
+#!/bin/bash
+echo "=== Task 28: Stack Usage Analysis and Guarded Stacks ==="
+
+ARCH="-march=rv32imac_zicsr -mabi=ilp32"
+CFLAGS="-O2 -ffreestanding -fno-tree-loop-distribute-patterns"   # No hidden memset calls
+SUFLAGS="-fstack-usage -fcallgraph-info=su"                    # Writes .su and .ci files
+
+# Stack sizes (multiples of 64); shrink them to what step 3 suggests
+STACK_SIZE=${STACK_SIZE:-2048}
+ISR_STACK_SIZE=${ISR_STACK_SIZE:-512}
+
+# Compile all components
+echo "1. Compiling stack demo components..."
+riscv32-unknown-elf-gcc $ARCH -c stack_start.s -o stack_start.o
+riscv32-unknown-elf-gcc $ARCH -c context_switch.s -o context_switch.o
+riscv32-unknown-elf-gcc $ARCH $CFLAGS $SUFLAGS -c clocksource.c -o clocksource.o
+riscv32-unknown-elf-gcc $ARCH $CFLAGS $SUFLAGS -c stack.c -o stack.o
+riscv32-unknown-elf-gcc $ARCH $CFLAGS $SUFLAGS -c task28_stack.c -o task28_stack.o
+
+# Link program: fixed-size main and ISR stacks with guards (sifive_e.ld)
+echo "2. Linking stack demo (main $STACK_SIZE B, ISR $ISR_STACK_SIZE B)..."
+riscv32-unknown-elf-gcc -T sifive_e.ld $ARCH -nostartfiles -nostdlib \
+    -Wl,--defsym=__stack_size=$STACK_SIZE -Wl,--defsym=__isr_stack_size=$ISR_STACK_SIZE \
+    stack_start.o context_switch.o clocksource.o stack.o task28_stack.o -lgcc -o task28_stack.elf || exit 1
+
+echo "✓ Compilation successful!"
+
+# Static worst case from the call graph. Every trap pushes a 64-byte
+# frame on the ISR stack before trap_dispatch runs.
+echo -e "\n3. Static worst-case stack depth (-fstack-usage / -fcallgraph-info):"
+sort -k2 -n -r -t$'\t' clocksource.su stack.su task28_stack.su | head -8
+echo
+bash stack_usage.sh main trap_dispatch+64 thread_body -- clocksource.ci stack.ci task28_stack.ci
+
+# Verify results
+echo -e "\n4. Memory layout:"
+riscv32-unknown-elf-size task28_stack.elf
+riscv32-unknown-elf-nm -n task28_stack.elf | grep -E " (_bss_end|_stack_guard|_stack_bottom|_stack_top|_isr_stack_guard|_isr_stack_bottom|_isr_stack_top|_free_start|_free_end)$"
+
+echo -e "\n✓ Stack demo ready!"
+echo "Run: qemu-system-riscv32 -M sifive_e -nographic -kernel task28_stack.elf"
@@ -0,0 +1,33 @@
+#!/bin/bash
+echo "=== Task 20: Interrupt-Driven UART Receive ==="
+
+ARCH="-march=rv32imac_zicsr -mabi=ilp32"
+
+# Compile all components
+echo "1. Compiling UART receive demo components..."
+riscv32-unknown-elf-gcc $ARCH -c trap_start.s -o trap_start.o
+riscv32-unknown-elf-gcc $ARCH -O2 -c uart_rx.c -o uart_rx.o
+riscv32-unknown-elf-gcc $ARCH -O2 -c task20_uart_rx.c -o task20_uart_rx.o
+riscv32-unknown-elf-gcc $ARCH -c syscalls.c -o syscalls.o -nostdlib
+
+# Link program
+echo "2. Linking UART receive demo..."
+riscv32-unknown-elf-gcc -T virt.ld $ARCH -nostartfiles trap_start.o task20_uart_rx.o uart_rx.o syscalls.o -o task20_uart_rx.elf
+
+echo "✓ Compilation successful!"
+
+# Verify results
+echo -e "\n3. Verifying UART receive demo:"
+file task20_uart_rx.elf
+
+echo -e "\n4. Receive path symbols:"
+riscv32-unknown-elf-nm task20_uart_rx.elf | grep -E "(uart_rx|_read|trap_)"
+
+echo -e "\n5. wfi in the blocking wait:"
+riscv32-unknown-elf-objdump -d task20_uart_rx.elf | grep -B 3 -A 3 "wfi"
+
+echo -e "\n6. Receive ring size:"
+riscv32-unknown-elf-nm -S task20_uart_rx.elf | grep rx_buf
+
+echo -e "\n✓ UART receive demo ready!"
+echo "Run: qemu-system-riscv32 -M virt -nographic -bios none -kernel task20_uart_rx.elf"
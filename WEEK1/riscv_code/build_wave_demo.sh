@@ -0,0 +1,31 @@
+#!/bin/bash
+echo "=== Task 30: Cycle-Timed GPIO Waveform Engine ==="
+
+ARCH="-march=rv32imac_zicsr -mabi=ilp32"
+CFLAGS="-O2 -ffreestanding -fno-tree-loop-distribute-patterns"   # No hidden memset calls
+
+# Compile all components
+echo "1. Compiling waveform demo components..."
+riscv32-unknown-elf-gcc $ARCH -c trap_start.s -o trap_start.o
+riscv32-unknown-elf-gcc $ARCH $CFLAGS -c clocksource.c -o clocksource.o
+riscv32-unknown-elf-gcc $ARCH $CFLAGS -c wave.c -o wave.o
+riscv32-unknown-elf-gcc $ARCH $CFLAGS -c task30_wave.c -o task30_wave.o
+
+# Link program: code in flash, data/BSS/stack in the 16K SRAM
+echo "2. Linking waveform demo..."
+riscv32-unknown-elf-gcc -T sifive_e.ld $ARCH -nostartfiles -nostdlib trap_start.o clocksource.o wave.o task30_wave.o -lgcc -o task30_wave.elf || exit 1
+
+echo "✓ Compilation successful!"
+
+# Verify results
+echo -e "\n3. Verifying waveform demo:"
+file task30_wave.elf
+riscv32-unknown-elf-size task30_wave.elf
+riscv32-unknown-elf-nm -S --size-sort task30_wave.elf | grep -E " (edges|wave)$"
+
+# The replay loop: spin on rdcycle, one store per edge
+echo -e "\n4. Replay loop (wave_play):"
+riscv32-unknown-elf-objdump -d task30_wave.elf | sed -n '/<wave_play>:/,/^$/p' | grep -E "rdcycle|csrc|csrs|sw|bltz|bgez|blt|bge"
+
+echo -e "\n✓ Waveform demo ready!"
+echo "Run: qemu-system-riscv32 -M sifive_e -nographic -kernel task30_wave.elf"
@@ -0,0 +1,32 @@
+#!/bin/bash
+echo "=== Task 25: Deferred Work Queue ==="
+
+ARCH="-march=rv32imac_zicsr -mabi=ilp32"
+
+# Compile all components
+echo "1. Compiling work queue demo components..."
+riscv32-unknown-elf-gcc $ARCH -c trap_start.s -o trap_start.o
+riscv32-unknown-elf-gcc $ARCH -O2 -c workq.c -o workq.o
+riscv32-unknown-elf-gcc $ARCH -O2 -c clocksource.c -o clocksource.o
+riscv32-unknown-elf-gcc $ARCH -O2 -c task25_workq.c -o task25_workq.o
+riscv32-unknown-elf-gcc $ARCH -c syscalls.c -o syscalls.o -nostdlib
+riscv32-unknown-elf-gcc $ARCH -O2 -c uart_rx.c -o uart_rx.o
+
+# Link program
+echo "2. Linking work queue demo..."
+riscv32-unknown-elf-gcc -T virt.ld $ARCH -nostartfiles trap_start.o task25_workq.o workq.o clocksource.o syscalls.o uart_rx.o -o task25_workq.elf
+
+echo "✓ Compilation successful!"
+
+# Verify results
+echo -e "\n3. Verifying work queue demo:"
+file task25_workq.elf
+
+echo -e "\n4. Lock-free enqueue (lr/sc compare-and-swap on the ring head):"
+riscv32-unknown-elf-objdump -d task25_workq.elf | sed -n '/<workq_enqueue_on>:/,/^$/p' | grep -E "lr\.w|sc\.w|amoadd"
+
+echo -e "\n5. Queue storage:"
+riscv32-unknown-elf-nm -S task25_workq.elf | grep " queues$"
+
+echo -e "\n✓ Work queue demo ready!"
+echo "Run: qemu-system-riscv32 -M virt -nographic -bios none -kernel task25_workq.elf"
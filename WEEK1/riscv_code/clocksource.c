@@ -0,0 +1,51 @@
+#include <stdint.h>
+#include "clocksource.h"
+#include "riscv_csr.h"
+
+uint64_t clock_div_u64_u32(uint64_t dividend, uint32_t divisor) {
+    uint64_t quotient = 0;
+    uint64_t rem = 0;
+
+    for (int bit = 63; bit >= 0; bit--) {
+        rem = (rem << 1) | ((dividend >> bit) & 1);
+        if (rem >= divisor) {
+            rem -= divisor;
+            quotient |= (uint64_t)1 << bit;
+        }
+    }
+    return quotient;
+}
+
+void clock_conv_init(clock_conv_t *conv, uint32_t from_hz, uint32_t to_hz) {
+    uint32_t shift;
+    uint64_t mult = 0;
+
+    for (shift = 32; shift > 0; shift--) {
+        mult = clock_div_u64_u32(((uint64_t)to_hz << shift) + from_hz / 2, from_hz);
+        if (mult <= 0xFFFFFFFFu) {
+            break;
+        }
+    }
+    if (shift == 0) {
+        mult = clock_div_u64_u32((uint64_t)to_hz + from_hz / 2, from_hz);
+    }
+
+    conv->mult = (uint32_t)mult;
+    conv->shift = shift;
+}
+
+uint32_t clock_calibrate_cpu_hz(uint32_t ticks) {
+    // Start on a tick edge so the window is a whole number of ticks
+    uint32_t t0 = mtime_read_lo();
+    while (mtime_read_lo() == t0) {
+    }
+    t0 = mtime_read_lo();
+    uint32_t c0 = rdcycle();
+
+    while (mtime_read_lo() - t0 < ticks) {
+    }
+    uint32_t c1 = rdcycle();
+
+    // cycles * TIMEBASE_HZ / ticks
+    return (uint32_t)clock_div_u64_u32((uint64_t)(c1 - c0) * TIMEBASE_HZ, ticks);
+}
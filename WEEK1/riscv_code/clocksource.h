@@ -0,0 +1,103 @@
+#ifndef CLOCKSOURCE_H
+#define CLOCKSOURCE_H
+
+#include <stdint.h>
+#include "regmap.h"
+
+// 64-bit timekeeping for RV32 on QEMU virt.
+// mtime/mtimecmp are 64-bit registers but RV32 can only access 32 bits at a
+// time, so every access here is split explicitly:
+//   - reads use hi/lo/hi and retry if the high word changed (carry)
+//   - mtimecmp writes go low = all-ones, high, low so no intermediate
+//     value is earlier than both the old and the new compare value
+
+// Memory-mapped timer registers (QEMU virt CLINT, see regmap.h)
+#define MTIME_BASE          REG_ADDR(clint_mtime_lo)
+#define MTIMECMP_BASE       REG_ADDR(clint_mtimecmp0_lo)
+#define MTIMECMP_ADDR(hart) (MTIMECMP_BASE + 8 * (hart))
+#define CLINT_MSIP_ADDR(h)  (REG_ADDR(clint_msip0) + 4 * (h))
+
+#ifndef TIMEBASE_HZ
+#define TIMEBASE_HZ         10000000u   // mtime rate on QEMU virt/sifive_e
+#endif                                  // (32768 on a real FE310)
+#define NSEC_PER_SEC        1000000000u
+
+#define MTIME_LO    (*(volatile uint32_t *)(MTIME_BASE))
+#define MTIME_HI    (*(volatile uint32_t *)(MTIME_BASE + 4))
+
+// Tear-free 64-bit mtime read over MMIO
+static inline uint64_t mtime_read(void) {
+    uint32_t hi, lo, hi2;
+    do {
+        hi = MTIME_HI;
+        lo = MTIME_LO;
+        hi2 = MTIME_HI;
+    } while (hi != hi2);
+    return ((uint64_t)hi << 32) | lo;
+}
+
+// Low word only: enough for deltas shorter than 2^32 ticks (~7 minutes)
+static inline uint32_t mtime_read_lo(void) {
+    return MTIME_LO;
+}
+
+// Fast path: the time CSR mirrors mtime without an uncached MMIO load.
+// QEMU implements it in every mode. On hardware that leaves it
+// unimplemented, the read traps and the firmware emulates it.
+static inline uint64_t rdtime64(void) {
+    uint32_t hi, lo, hi2;
+    do {
+        asm volatile ("rdtimeh %0" : "=r"(hi));
+        asm volatile ("rdtime %0" : "=r"(lo));
+        asm volatile ("rdtimeh %0" : "=r"(hi2));
+    } while (hi != hi2);
+    return ((uint64_t)hi << 32) | lo;
+}
+
+static inline uint32_t rdtime_lo(void) {
+    uint32_t lo;
+    asm volatile ("rdtime %0" : "=r"(lo));
+    return lo;
+}
+
+// Safe mtimecmp update (RISC-V privileged spec, "Machine Timer Registers")
+static inline void mtimecmp_write(uint32_t hart, uint64_t when) {
+    volatile uint32_t *cmp = (volatile uint32_t *)MTIMECMP_ADDR(hart);
+    cmp[0] = 0xFFFFFFFFu;              // No smaller value than the old one
+    cmp[1] = (uint32_t)(when >> 32);   // No smaller value than the new one
+    cmp[0] = (uint32_t)when;           // New value
+}
+
+// Division-free rate conversion: out = (in * mult) >> shift.
+// mult/shift are computed once by clock_conv_init().
+typedef struct {
+    uint32_t mult;
+    uint32_t shift;
+} clock_conv_t;
+
+// 64 x 32 -> 96-bit multiply, shifted right (shift <= 32). Uses only 32x32
+// multiplies, which RV32M does inline (mul/mulhu), so no libgcc helpers.
+static inline uint64_t mul_u64_u32_shr(uint64_t a, uint32_t mult, uint32_t shift) {
+    uint32_t ah = (uint32_t)(a >> 32);
+    uint32_t al = (uint32_t)a;
+    uint64_t ret = ((uint64_t)al * mult) >> shift;
+
+    if (ah) {
+        ret += ((uint64_t)ah * mult) << (32 - shift);
+    }
+    return ret;
+}
+
+static inline uint64_t clock_convert(const clock_conv_t *conv, uint64_t in) {
+    return mul_u64_u32_shr(in, conv->mult, conv->shift);
+}
+
+// clocksource.c
+// Pick the largest shift (most precision) that still keeps mult in 32 bits
+void clock_conv_init(clock_conv_t *conv, uint32_t from_hz, uint32_t to_hz);
+// 64 / 32 division by shift-and-subtract (setup and calibration only)
+uint64_t clock_div_u64_u32(uint64_t dividend, uint32_t divisor);
+// Measure the rdcycle rate against mtime over the given number of ticks
+uint32_t clock_calibrate_cpu_hz(uint32_t ticks);
+
+#endif /* CLOCKSOURCE_H */
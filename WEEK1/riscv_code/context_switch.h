@@ -0,0 +1,18 @@
+#ifndef CONTEXT_SWITCH_H
+#define CONTEXT_SWITCH_H
+
+#include <stdint.h>
+
+// Stackful cooperative switching (context_switch.s).
+// The frame pushed on a stack is 64 bytes: ra at 0, s0-s11 at 4..48.
+// A new thread starts from a frame with ra = thread_bootstrap, s0 = entry.
+#define CONTEXT_FRAME_SIZE  64
+
+// Save callee-saved registers on the current stack, store sp to *save_sp,
+// continue on next_sp
+void context_switch(uint32_t *save_sp, uint32_t next_sp);
+
+// Initial return address of a new thread: calls the function in s0
+void thread_bootstrap(void);
+
+#endif /* CONTEXT_SWITCH_H */
@@ -0,0 +1,50 @@
+# Cooperative context switch for stackful threads (Task 18 scheduler,
+# Task 26 threaded baseline). Integer-only, so it assembles for any RV32.
+
+.section .text
+
+# void context_switch(uint32_t *save_sp, uint32_t next_sp)
+# Pushes ra and s0-s11 on the current stack, stores sp, then pops the
+# same frame from the next thread's stack. FP state is handled in C.
+.global context_switch
+context_switch:
+    addi sp, sp, -64
+    sw ra,  0(sp)
+    sw s0,  4(sp)
+    sw s1,  8(sp)
+    sw s2, 12(sp)
+    sw s3, 16(sp)
+    sw s4, 20(sp)
+    sw s5, 24(sp)
+    sw s6, 28(sp)
+    sw s7, 32(sp)
+    sw s8, 36(sp)
+    sw s9, 40(sp)
+    sw s10, 44(sp)
+    sw s11, 48(sp)
+    sw sp, 0(a0)
+
+    mv sp, a1
+    lw ra,  0(sp)
+    lw s0,  4(sp)
+    lw s1,  8(sp)
+    lw s2, 12(sp)
+    lw s3, 16(sp)
+    lw s4, 20(sp)
+    lw s5, 24(sp)
+    lw s6, 28(sp)
+    lw s7, 32(sp)
+    lw s8, 36(sp)
+    lw s9, 40(sp)
+    lw s10, 44(sp)
+    lw s11, 48(sp)
+    addi sp, sp, 64
+    ret
+.size context_switch, . - context_switch
+
+# First "return" of a new thread lands here: s0 holds the entry point
+.global thread_bootstrap
+thread_bootstrap:
+    jalr s0
+1:  j 1b
+.size thread_bootstrap, . - thread_bootstrap
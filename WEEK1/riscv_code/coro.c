@@ -0,0 +1,233 @@
+#include <stdint.h>
+#include "coro.h"
+#include "clocksource.h"
+#include "gpio_hal.h"
+#include "plic.h"
+#include "riscv_csr.h"
+#include "sifive_uart.h"
+
+#define RX_RING_SIZE    16      // Power of two
+
+static coro_t *tasks = 0;
+static volatile int stop_requested = 0;
+static coro_stats_t stats;
+
+// Set by interrupt handlers, consumed by the event loop
+static volatile uint32_t event_flag = 0;
+static volatile uint32_t gpio_rise_events = 0;
+static volatile uint32_t gpio_fall_events = 0;
+static volatile uint8_t rx_ring[RX_RING_SIZE];
+static volatile uint32_t rx_head = 0;
+static uint32_t rx_tail = 0;
+
+// Fatal trap information (inspect with GDB)
+volatile uint32_t fatal_mcause = 0;
+volatile uint32_t fatal_mepc = 0;
+
+void coro_init(void) {
+    sifive_uart_init();
+    SIFIVE_UART_REG(SIFIVE_UART_IE) = SIFIVE_UART_IE_RXWM;
+    plic_set_priority(SIFIVE_UART0_IRQ, 1);
+    plic_enable(PLIC_CTX_M_HART0, SIFIVE_UART0_IRQ);
+    plic_set_threshold(PLIC_CTX_M_HART0, 0);
+
+    mtimecmp_write(0, UINT64_MAX);
+    set_csr(mie, MIP_MTIP | MIP_MEIP);
+    set_csr(mstatus, MSTATUS_MIE);
+}
+
+void coro_spawn(coro_t *c, coro_fn_t fn) {
+    c->fn = fn;
+    c->line = 0;
+    c->state = CORO_READY;
+    c->next = tasks;
+    tasks = c;
+}
+
+void coro_reset(void) {
+    tasks = 0;
+    stop_requested = 0;
+    stats.resumes = 0;
+    stats.loops = 0;
+    stats.sleeps = 0;
+    stats.irqs = 0;
+}
+
+void coro_stop(void) {
+    stop_requested = 1;
+}
+
+void coro_gpio_arm(coro_t *c, uint32_t pin, uint32_t edge) {
+    uint32_t bit = 1u << pin;
+
+    c->pin = (uint8_t)pin;
+    c->edge = (uint8_t)edge;
+
+    // Only edges from now on count
+    clear_csr(mstatus, MSTATUS_MIE);
+    gpio_rise_events &= ~bit;
+    gpio_fall_events &= ~bit;
+    set_csr(mstatus, MSTATUS_MIE);
+
+    GPIO_SET_BIT(GPIO_INPUT_EN, pin);
+    if (edge & CORO_EDGE_RISE) {
+        GPIO_SET_BIT(GPIO_RISE_IE, pin);
+    }
+    if (edge & CORO_EDGE_FALL) {
+        GPIO_SET_BIT(GPIO_FALL_IE, pin);
+    }
+    plic_set_priority(GPIO_IRQ_BASE + pin, 1);
+    plic_enable(PLIC_CTX_M_HART0, GPIO_IRQ_BASE + pin);
+}
+
+void coro_get_stats(coro_stats_t *out) {
+    *out = stats;
+}
+
+// Move waiting coroutines whose event happened to READY
+static void coro_poll(void) {
+    uint32_t now = mtime_read_lo();
+
+    for (coro_t *c = tasks; c; c = c->next) {
+        switch (c->state) {
+        case CORO_WAIT_TICKS:
+            if ((int32_t)(now - c->wake) >= 0) {
+                c->state = CORO_READY;
+            }
+            break;
+
+        case CORO_WAIT_GPIO: {
+            uint32_t bit = 1u << c->pin;
+            uint32_t seen = 0;
+            clear_csr(mstatus, MSTATUS_MIE);
+            if ((c->edge & CORO_EDGE_RISE) && (gpio_rise_events & bit)) seen = 1;
+            if ((c->edge & CORO_EDGE_FALL) && (gpio_fall_events & bit)) seen = 1;
+            if (seen) {
+                gpio_rise_events &= ~bit;
+                gpio_fall_events &= ~bit;
+                c->state = CORO_READY;
+            }
+            set_csr(mstatus, MSTATUS_MIE);
+            break;
+        }
+
+        case CORO_WAIT_UART:
+            if (rx_tail != rx_head) {
+                c->rx_byte = rx_ring[rx_tail & (RX_RING_SIZE - 1)];
+                rx_tail++;
+                c->state = CORO_READY;
+            }
+            break;
+        }
+    }
+}
+
+// Program mtimecmp for the nearest await_ticks deadline (if any)
+static void coro_arm_timer(void) {
+    uint64_t now = mtime_read();
+    int32_t nearest = INT32_MAX;
+    int any = 0;
+
+    for (coro_t *c = tasks; c; c = c->next) {
+        if (c->state == CORO_WAIT_TICKS) {
+            int32_t left = (int32_t)(c->wake - (uint32_t)now);
+            if (left < nearest) {
+                nearest = left;
+            }
+            any = 1;
+        }
+    }
+    if (any) {
+        mtimecmp_write(0, now + (nearest > 0 ? (uint32_t)nearest : 0));
+    }
+}
+
+void coro_run(void) {
+    while (!stop_requested) {
+        int ready = 0;
+        int alive = 0;
+
+        stats.loops++;
+        event_flag = 0;
+        coro_poll();
+
+        for (coro_t *c = tasks; c && !stop_requested; c = c->next) {
+            if (c->state == CORO_READY) {
+                stats.resumes++;
+                c->fn(c);
+                ready = 1;
+            }
+            if (c->state != CORO_DONE) {
+                alive = 1;
+            }
+        }
+        if (!alive) {
+            break;
+        }
+        if (ready || stop_requested) {
+            continue;
+        }
+
+        // Everyone is waiting: sleep until an interrupt says otherwise.
+        // MIE is masked so an event between the check and wfi is not lost.
+        coro_arm_timer();
+        clear_csr(mstatus, MSTATUS_MIE);
+        if (!event_flag) {
+            stats.sleeps++;
+            asm volatile ("wfi");
+        }
+        set_csr(mstatus, MSTATUS_MIE);
+    }
+}
+
+static void coro_external_irq(void) {
+    uint32_t irq = plic_claim(PLIC_CTX_M_HART0);
+
+    if (irq == SIFIVE_UART0_IRQ) {
+        int ch;
+        while ((ch = sifive_uart_getc()) >= 0) {
+            if (rx_head - rx_tail < RX_RING_SIZE) {
+                rx_ring[rx_head & (RX_RING_SIZE - 1)] = (uint8_t)ch;
+                rx_head++;
+            }
+        }
+    } else if (irq >= GPIO_IRQ_BASE && irq < GPIO_IRQ_BASE + 32) {
+        uint32_t bit = 1u << (irq - GPIO_IRQ_BASE);
+        volatile uint32_t *rise_ip = (volatile uint32_t *)GPIO_RISE_IP;
+        volatile uint32_t *fall_ip = (volatile uint32_t *)GPIO_FALL_IP;
+
+        gpio_rise_events |= *rise_ip & bit;
+        gpio_fall_events |= *fall_ip & bit;
+        *rise_ip = bit;     // Write 1 to clear
+        *fall_ip = bit;
+    }
+
+    if (irq) {
+        plic_complete(PLIC_CTX_M_HART0, irq);
+    }
+}
+
+// Called from trap_entry (trap_start.s)
+void trap_dispatch(uint32_t mcause, uint32_t mepc, uint32_t mtval) {
+    if (mcause & MCAUSE_INTERRUPT) {
+        stats.irqs++;
+        switch (MCAUSE_CODE(mcause)) {
+        case IRQ_M_TIMER:
+            mtimecmp_write(0, UINT64_MAX);  // One-shot, re-armed by the loop
+            break;
+        case IRQ_M_EXT:
+            coro_external_irq();
+            break;
+        }
+        event_flag = 1;
+        return;
+    }
+
+    // Unexpected exception: park the hart (inspect with GDB)
+    (void)mtval;
+    fatal_mcause = mcause;
+    fatal_mepc = mepc;
+    while (1) {
+        asm volatile ("wfi");
+    }
+}
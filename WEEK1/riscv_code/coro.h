@@ -0,0 +1,104 @@
+#ifndef CORO_H
+#define CORO_H
+
+#include <stdint.h>
+#include "clocksource.h"
+
+// Stackless coroutines (protothread style) and a single event loop.
+//
+// A coroutine is a function that returns whenever it has to wait and is
+// re-entered at the same point through a switch on the saved line number
+// (Duff's device). Only the coro_t and whatever the task keeps in its own
+// struct survive a wait - local variables do not, and the body must not
+// contain its own switch statement around an await.
+//
+//   typedef struct { coro_t co; uint32_t count; } blinker_t;
+//
+//   static int blink(coro_t *c) {
+//       blinker_t *b = (blinker_t *)c;
+//       CORO_BEGIN(c);
+//       for (;;) {
+//           b->count++;
+//           await_ticks(c, TIMEBASE_HZ / 10);
+//       }
+//       CORO_END(c);
+//   }
+
+typedef enum {
+    CORO_READY,
+    CORO_WAIT_TICKS,
+    CORO_WAIT_GPIO,
+    CORO_WAIT_UART,
+    CORO_DONE
+} coro_state_t;
+
+#define CORO_EDGE_RISE  1
+#define CORO_EDGE_FALL  2
+#define CORO_EDGE_ANY   (CORO_EDGE_RISE | CORO_EDGE_FALL)
+
+typedef struct coro {
+    struct coro *next;          // Event loop task list
+    int (*fn)(struct coro *);   // Body, returns the new state
+    uint16_t line;              // Resume point (0 = start)
+    uint8_t state;              // coro_state_t
+    uint8_t pin;                // CORO_WAIT_GPIO: pin number
+    uint8_t edge;               // CORO_WAIT_GPIO: CORO_EDGE_*
+    uint8_t rx_byte;            // CORO_WAIT_UART: the byte received
+    uint32_t wake;              // CORO_WAIT_TICKS: mtime low word deadline
+} coro_t;
+
+typedef int (*coro_fn_t)(coro_t *c);
+
+typedef struct {
+    uint32_t resumes;           // Coroutine bodies entered
+    uint32_t loops;             // Event loop iterations
+    uint32_t sleeps;            // wfi executed
+    uint32_t irqs;              // Interrupts taken
+} coro_stats_t;
+
+// Resume-point machinery
+#define CORO_BEGIN(c)   switch ((c)->line) { case 0:
+#define CORO_END(c)     } (c)->line = 0; (c)->state = CORO_DONE; return CORO_DONE
+
+#define CORO_WAIT_POINT(c, st)                                      \
+    do {                                                            \
+        (c)->state = (st);                                          \
+        (c)->line = __LINE__;                                       \
+        return (st);                                                \
+        case __LINE__:;                                             \
+    } while (0)
+
+// Let the other coroutines run, continue on the next loop iteration
+#define CORO_YIELD(c)   CORO_WAIT_POINT(c, CORO_READY)
+
+// Sleep for n mtime ticks (n < 2^31)
+#define await_ticks(c, n)                                           \
+    do {                                                            \
+        (c)->wake = mtime_read_lo() + (uint32_t)(n);                \
+        CORO_WAIT_POINT(c, CORO_WAIT_TICKS);                        \
+    } while (0)
+
+// Wait for an edge on a GPIO input that happens after this call
+#define await_gpio_edge(c, p, e)                                    \
+    do {                                                            \
+        coro_gpio_arm((c), (p), (e));                               \
+        CORO_WAIT_POINT(c, CORO_WAIT_GPIO);                         \
+    } while (0)
+
+// Wait for one byte from UART0, stored to *(dst)
+#define await_uart_rx(c, dst)                                       \
+    do {                                                            \
+        CORO_WAIT_POINT(c, CORO_WAIT_UART);                         \
+        *(dst) = (c)->rx_byte;                                      \
+    } while (0)
+
+// coro.c
+void coro_init(void);                   // UART RX + PLIC + interrupts on
+void coro_spawn(coro_t *c, coro_fn_t fn);
+void coro_reset(void);                  // Forget all tasks
+void coro_run(void);                    // Until coro_stop() or all done
+void coro_stop(void);
+void coro_gpio_arm(coro_t *c, uint32_t pin, uint32_t edge);
+void coro_get_stats(coro_stats_t *stats);
+
+#endif /* CORO_H */
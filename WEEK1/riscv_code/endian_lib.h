@@ -0,0 +1,210 @@
+#ifndef ENDIAN_LIB_H
+#define ENDIAN_LIB_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// Header-only endian / wire-format helpers for RV32.
+// Byte swaps use Zbb rev8 when the compiler is told about Zbb
+// (-march=..._zbb defines __riscv_zbb), otherwise shift/mask.
+
+// ---------------------------------------------------------------------------
+// Byte swap
+// ---------------------------------------------------------------------------
+
+static inline uint32_t bswap32(uint32_t x) {
+#if defined(__riscv_zbb) && (__riscv_xlen == 32)
+    uint32_t r;
+    asm ("rev8 %0, %1" : "=r"(r) : "r"(x));
+    return r;
+#else
+    return ((x & 0x000000FFu) << 24) |
+           ((x & 0x0000FF00u) << 8)  |
+           ((x & 0x00FF0000u) >> 8)  |
+           ((x & 0xFF000000u) >> 24);
+#endif
+}
+
+static inline uint16_t bswap16(uint16_t x) {
+#if defined(__riscv_zbb) && (__riscv_xlen == 32)
+    return (uint16_t)(bswap32(x) >> 16);
+#else
+    return (uint16_t)((x << 8) | (x >> 8));
+#endif
+}
+
+static inline uint64_t bswap64(uint64_t x) {
+    // Two 32-bit swaps with the halves exchanged (no 64-bit shifts on RV32)
+    return ((uint64_t)bswap32((uint32_t)x) << 32) | bswap32((uint32_t)(x >> 32));
+}
+
+// ---------------------------------------------------------------------------
+// Unaligned loads/stores (any address, byte accesses, branch-free)
+// ---------------------------------------------------------------------------
+
+static inline uint8_t load_le8(const void *p) { return *(const uint8_t *)p; }
+static inline uint8_t load_be8(const void *p) { return *(const uint8_t *)p; }
+
+static inline uint16_t load_le16(const void *p) {
+    const uint8_t *b = (const uint8_t *)p;
+    return (uint16_t)(b[0] | (b[1] << 8));
+}
+
+static inline uint16_t load_be16(const void *p) {
+    const uint8_t *b = (const uint8_t *)p;
+    return (uint16_t)((b[0] << 8) | b[1]);
+}
+
+static inline uint32_t load_le32(const void *p) {
+    const uint8_t *b = (const uint8_t *)p;
+    return (uint32_t)b[0] | ((uint32_t)b[1] << 8) |
+           ((uint32_t)b[2] << 16) | ((uint32_t)b[3] << 24);
+}
+
+static inline uint32_t load_be32(const void *p) {
+    const uint8_t *b = (const uint8_t *)p;
+    return ((uint32_t)b[0] << 24) | ((uint32_t)b[1] << 16) |
+           ((uint32_t)b[2] << 8) | (uint32_t)b[3];
+}
+
+static inline uint64_t load_le64(const void *p) {
+    const uint8_t *b = (const uint8_t *)p;
+    return (uint64_t)load_le32(b) | ((uint64_t)load_le32(b + 4) << 32);
+}
+
+static inline uint64_t load_be64(const void *p) {
+    const uint8_t *b = (const uint8_t *)p;
+    return ((uint64_t)load_be32(b) << 32) | (uint64_t)load_be32(b + 4);
+}
+
+static inline void store_le8(void *p, uint8_t v) { *(uint8_t *)p = v; }
+static inline void store_be8(void *p, uint8_t v) { *(uint8_t *)p = v; }
+
+static inline void store_le16(void *p, uint16_t v) {
+    uint8_t *b = (uint8_t *)p;
+    b[0] = (uint8_t)v;
+    b[1] = (uint8_t)(v >> 8);
+}
+
+static inline void store_be16(void *p, uint16_t v) {
+    uint8_t *b = (uint8_t *)p;
+    b[0] = (uint8_t)(v >> 8);
+    b[1] = (uint8_t)v;
+}
+
+static inline void store_le32(void *p, uint32_t v) {
+    uint8_t *b = (uint8_t *)p;
+    b[0] = (uint8_t)v;
+    b[1] = (uint8_t)(v >> 8);
+    b[2] = (uint8_t)(v >> 16);
+    b[3] = (uint8_t)(v >> 24);
+}
+
+static inline void store_be32(void *p, uint32_t v) {
+    uint8_t *b = (uint8_t *)p;
+    b[0] = (uint8_t)(v >> 24);
+    b[1] = (uint8_t)(v >> 16);
+    b[2] = (uint8_t)(v >> 8);
+    b[3] = (uint8_t)v;
+}
+
+static inline void store_le64(void *p, uint64_t v) {
+    uint8_t *b = (uint8_t *)p;
+    store_le32(b, (uint32_t)v);
+    store_le32(b + 4, (uint32_t)(v >> 32));
+}
+
+static inline void store_be64(void *p, uint64_t v) {
+    uint8_t *b = (uint8_t *)p;
+    store_be32(b, (uint32_t)(v >> 32));
+    store_be32(b + 4, (uint32_t)v);
+}
+
+// ---------------------------------------------------------------------------
+// Aligned fast paths (caller guarantees natural alignment)
+// One lw (+ rev8 for the foreign order) instead of four lbu + shifts
+// ---------------------------------------------------------------------------
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define NATIVE_TO_LE32(x) (x)
+#define NATIVE_TO_BE32(x) bswap32(x)
+#else
+#define NATIVE_TO_LE32(x) bswap32(x)
+#define NATIVE_TO_BE32(x) (x)
+#endif
+
+static inline uint32_t load_le32_aligned(const uint32_t *p) { return NATIVE_TO_LE32(*p); }
+static inline uint32_t load_be32_aligned(const uint32_t *p) { return NATIVE_TO_BE32(*p); }
+static inline void store_le32_aligned(uint32_t *p, uint32_t v) { *p = NATIVE_TO_LE32(v); }
+static inline void store_be32_aligned(uint32_t *p, uint32_t v) { *p = NATIVE_TO_BE32(v); }
+
+// ---------------------------------------------------------------------------
+// Packed struct field access
+// Reading p->field directly is fine, but taking &p->field and passing it
+// around as a uint32_t * loses the packed attribute and faults (or traps
+// to a slow emulation) on misaligned addresses. These go through memcpy,
+// which GCC turns into the right byte loads/stores for the field size.
+// ---------------------------------------------------------------------------
+
+#define PACKED_GET(ptr, field) ({                                         \
+    __typeof__((ptr)->field) __pv;                                        \
+    memcpy(&__pv, (const uint8_t *)(ptr) +                                \
+           offsetof(__typeof__(*(ptr)), field), sizeof(__pv));            \
+    __pv; })
+
+#define PACKED_SET(ptr, field, value) do {                                \
+    __typeof__((ptr)->field) __pv = (value);                              \
+    memcpy((uint8_t *)(ptr) + offsetof(__typeof__(*(ptr)), field),        \
+           &__pv, sizeof(__pv));                                          \
+} while (0)
+
+// Unaligned access through an arbitrary pointer (e.g. &packed->b)
+static inline uint16_t load_unaligned16(const void *p) {
+    uint16_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint32_t load_unaligned32(const void *p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+/*
+ * Compile-time described wire structs
+ *
+ *   #define MY_MSG_FIELDS(X)      \
+ *       X(uint8_t,  a,  8, le)    \
+ *       X(uint32_t, b, 32, be)
+ *   WIRE_STRUCT(my_msg, MY_MSG_FIELDS)
+ *
+ * generates struct my_msg (natural alignment), my_msg_WIRE_SIZE, and
+ * my_msg_encode()/my_msg_decode(): straight-line code with constant
+ * offsets, no loops and no branches.
+ */
+
+#define WIRE_MEMBER(type, name, bits, order)  type name;
+#define WIRE_SIZE_TERM(type, name, bits, order) + ((bits) / 8)
+#define WIRE_CHECK(type, name, bits, order) \
+    _Static_assert(sizeof(type) * 8 == (bits), "wire field " #name " width mismatch");
+#define WIRE_ENCODE(type, name, bits, order) \
+    store_##order##bits(buf, msg->name); buf += (bits) / 8;
+#define WIRE_DECODE(type, name, bits, order) \
+    msg->name = (type)load_##order##bits(buf); buf += (bits) / 8;
+
+#define WIRE_STRUCT(sname, FIELDS)                                        \
+    struct sname { FIELDS(WIRE_MEMBER) };                                 \
+    FIELDS(WIRE_CHECK)                                                    \
+    enum { sname##_WIRE_SIZE = 0 FIELDS(WIRE_SIZE_TERM) };                \
+    static inline void sname##_encode(const struct sname *msg,            \
+                                      uint8_t *buf) {                     \
+        FIELDS(WIRE_ENCODE)                                               \
+    }                                                                     \
+    static inline void sname##_decode(struct sname *msg,                  \
+                                      const uint8_t *buf) {               \
+        FIELDS(WIRE_DECODE)                                               \
+    }
+
+#endif /* ENDIAN_LIB_H */
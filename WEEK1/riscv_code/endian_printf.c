@@ -2,13 +2,11 @@
 #include <stdint.h>
 #include <sys/stat.h>
 #include <unistd.h>
+#include "uart_rx.h"
 
 // UART for printf output
-#define UART_BASE 0x10000000
-#define UART_TX_REG (*(volatile uint32_t *)(UART_BASE + 0x00))
-
 void uart_putchar(char c) {
-    UART_TX_REG = (uint32_t)c;
+    reg_write(ns16550_thr, (data, c));
 }
 
 int _write(int fd, char *buf, int len) {
@@ -32,4 +30,6 @@ int _fstat(int fd, struct stat *st) {
 }
 int _isatty(int fd) { return (fd <= 2) ? 1 : 0; }
 int _lseek(int fd, int offset, int whence) { return -1; }
-int _read(int fd, char *buf, int len) { return -1; }
+int _read(int fd, char *buf, int len) {
+    return (fd == STDIN_FILENO) ? uart_rx_read(buf, len) : -1;
+}
@@ -0,0 +1,49 @@
+#ifndef FP_CONTEXT_H
+#define FP_CONTEXT_H
+
+#include <stdint.h>
+#include "context_switch.h"
+
+// Saved floating-point state for RV32IMAFD: f0-f31 (64-bit) plus fcsr
+// Layout is shared with fp_context.s: f[i] at i*8, fcsr at 256
+typedef struct {
+    uint64_t f[32];
+    uint32_t fcsr;
+    uint32_t pad;
+} fp_context_t;
+
+// Cooperative thread: callee-saved integer registers live on its own stack,
+// FP registers are saved here only when the FP policy requires it
+typedef struct thread {
+    uint32_t sp;            // Saved stack pointer (set by context_switch)
+    uint32_t fp_saves;      // FP register file written to memory
+    uint32_t fp_restores;   // FP register file loaded from memory
+    const char *name;
+    fp_context_t fp;        // FP register save area
+} thread_t;
+
+// How FP state is handled on context switch and trap entry
+typedef enum {
+    FP_POLICY_EAGER,        // Always save/restore all 32 FP registers + fcsr
+    FP_POLICY_LAZY          // Track mstatus.FS, save only Dirty state on demand
+} fp_policy_t;
+
+// Assembly helpers (fp_context.s)
+void fp_context_save(fp_context_t *ctx);
+void fp_context_restore(const fp_context_t *ctx);
+void trap_entry_lazy(void);
+void trap_entry_eager(void);
+
+// Scheduler / trap side (fp_sched.c) - integer-only code, never touches FP
+void sched_init(thread_t *main_thread);
+void thread_create(thread_t *t, const char *name, void (*entry)(void),
+                   uint32_t *stack, uint32_t stack_words);
+void thread_yield(void);
+void fp_set_policy(fp_policy_t policy);
+uint32_t fp_lazy_traps(void);
+void trap_dispatch(uint32_t mcause, uint32_t mepc, uint32_t mtval);
+
+// Provided by the application for interrupt causes
+void machine_irq_handler(uint32_t irq);
+
+#endif /* FP_CONTEXT_H */
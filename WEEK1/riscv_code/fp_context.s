@@ -0,0 +1,165 @@
+# Floating-point context save/restore and trap entry points for the lazy
+# FP context switching demo (Task 18). The integer context switch itself
+# is in context_switch.s.
+# Layout of fp_context_t: f0-f31 at offset 8*i, fcsr at offset 256.
+
+.section .text
+
+# Save/restore the 16 caller-saved integer registers (64-byte frame)
+.macro SAVE_CALLER_REGS
+    sw ra,  0(sp)
+    sw t0,  4(sp)
+    sw t1,  8(sp)
+    sw t2, 12(sp)
+    sw a0, 16(sp)
+    sw a1, 20(sp)
+    sw a2, 24(sp)
+    sw a3, 28(sp)
+    sw a4, 32(sp)
+    sw a5, 36(sp)
+    sw a6, 40(sp)
+    sw a7, 44(sp)
+    sw t3, 48(sp)
+    sw t4, 52(sp)
+    sw t5, 56(sp)
+    sw t6, 60(sp)
+.endm
+
+.macro RESTORE_CALLER_REGS
+    lw ra,  0(sp)
+    lw t0,  4(sp)
+    lw t1,  8(sp)
+    lw t2, 12(sp)
+    lw a0, 16(sp)
+    lw a1, 20(sp)
+    lw a2, 24(sp)
+    lw a3, 28(sp)
+    lw a4, 32(sp)
+    lw a5, 36(sp)
+    lw a6, 40(sp)
+    lw a7, 44(sp)
+    lw t3, 48(sp)
+    lw t4, 52(sp)
+    lw t5, 56(sp)
+    lw t6, 60(sp)
+.endm
+
+# void fp_context_save(fp_context_t *ctx)
+.global fp_context_save
+fp_context_save:
+    fsd f0, 0(a0)
+    fsd f1, 8(a0)
+    fsd f2, 16(a0)
+    fsd f3, 24(a0)
+    fsd f4, 32(a0)
+    fsd f5, 40(a0)
+    fsd f6, 48(a0)
+    fsd f7, 56(a0)
+    fsd f8, 64(a0)
+    fsd f9, 72(a0)
+    fsd f10, 80(a0)
+    fsd f11, 88(a0)
+    fsd f12, 96(a0)
+    fsd f13, 104(a0)
+    fsd f14, 112(a0)
+    fsd f15, 120(a0)
+    fsd f16, 128(a0)
+    fsd f17, 136(a0)
+    fsd f18, 144(a0)
+    fsd f19, 152(a0)
+    fsd f20, 160(a0)
+    fsd f21, 168(a0)
+    fsd f22, 176(a0)
+    fsd f23, 184(a0)
+    fsd f24, 192(a0)
+    fsd f25, 200(a0)
+    fsd f26, 208(a0)
+    fsd f27, 216(a0)
+    fsd f28, 224(a0)
+    fsd f29, 232(a0)
+    fsd f30, 240(a0)
+    fsd f31, 248(a0)
+    frcsr t0
+    sw t0, 256(a0)
+    ret
+.size fp_context_save, . - fp_context_save
+
+# void fp_context_restore(const fp_context_t *ctx)
+.global fp_context_restore
+fp_context_restore:
+    lw t0, 256(a0)
+    fscsr t0
+    fld f0, 0(a0)
+    fld f1, 8(a0)
+    fld f2, 16(a0)
+    fld f3, 24(a0)
+    fld f4, 32(a0)
+    fld f5, 40(a0)
+    fld f6, 48(a0)
+    fld f7, 56(a0)
+    fld f8, 64(a0)
+    fld f9, 72(a0)
+    fld f10, 80(a0)
+    fld f11, 88(a0)
+    fld f12, 96(a0)
+    fld f13, 104(a0)
+    fld f14, 112(a0)
+    fld f15, 120(a0)
+    fld f16, 128(a0)
+    fld f17, 136(a0)
+    fld f18, 144(a0)
+    fld f19, 152(a0)
+    fld f20, 160(a0)
+    fld f21, 168(a0)
+    fld f22, 176(a0)
+    fld f23, 184(a0)
+    fld f24, 192(a0)
+    fld f25, 200(a0)
+    fld f26, 208(a0)
+    fld f27, 216(a0)
+    fld f28, 224(a0)
+    fld f29, 232(a0)
+    fld f30, 240(a0)
+    fld f31, 248(a0)
+    ret
+.size fp_context_restore, . - fp_context_restore
+
+# Lazy trap entry: integer registers only. FP registers are left live;
+# trap_dispatch is integer-only so it can never clobber them.
+.balign 4
+.global trap_entry_lazy
+trap_entry_lazy:
+    addi sp, sp, -64
+    SAVE_CALLER_REGS
+
+    csrr a0, mcause
+    csrr a1, mepc
+    csrr a2, mtval
+    call trap_dispatch
+
+    RESTORE_CALLER_REGS
+    addi sp, sp, 64
+    mret
+.size trap_entry_lazy, . - trap_entry_lazy
+
+# Eager trap entry: additionally spills all 32 FP registers + fcsr
+# (264 bytes) on every trap, the cost a naive handler would pay.
+.balign 4
+.global trap_entry_eager
+trap_entry_eager:
+    addi sp, sp, -336
+    SAVE_CALLER_REGS
+    addi a0, sp, 64
+    call fp_context_save
+
+    csrr a0, mcause
+    csrr a1, mepc
+    csrr a2, mtval
+    call trap_dispatch
+
+    addi a0, sp, 64
+    call fp_context_restore
+    RESTORE_CALLER_REGS
+    addi sp, sp, 336
+    mret
+.size trap_entry_eager, . - trap_entry_eager
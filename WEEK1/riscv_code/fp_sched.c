@@ -0,0 +1,234 @@
+#include "fp_context.h"
+#include "riscv_csr.h"
+
+// NOTE: this file is integer-only on purpose. It runs inside the trap
+// handler and while mstatus.FS may be Off, so it must never emit an FP
+// instruction (build_lazy_fp_demo.sh checks the object file for that).
+
+#define MAX_THREADS 4
+
+// Round-robin thread table
+static thread_t *threads[MAX_THREADS];
+static int thread_count = 0;
+static int current_index = 0;
+
+// Lazy FP bookkeeping
+static fp_policy_t fp_policy = FP_POLICY_LAZY;
+static thread_t *fp_owner = 0;        // Thread whose state is live in f0-f31
+static uint32_t fp_owner_dirty = 0;   // Live registers newer than fp_owner->fp
+static uint32_t lazy_trap_count = 0;
+
+// Fatal trap information (inspect with GDB)
+volatile uint32_t fatal_mcause = 0;
+volatile uint32_t fatal_mepc = 0;
+volatile uint32_t fatal_mtval = 0;
+
+static inline thread_t *current_thread(void) {
+    return threads[current_index];
+}
+
+static inline uint32_t get_fs(void) {
+    return read_csr(mstatus) & MSTATUS_FS;
+}
+
+static inline void set_fs(uint32_t fs) {
+    clear_csr(mstatus, MSTATUS_FS);
+    if (fs) {
+        set_csr(mstatus, fs);
+    }
+}
+
+void sched_init(thread_t *main_thread) {
+    main_thread->name = "main";
+    threads[0] = main_thread;
+    thread_count = 1;
+    current_index = 0;
+
+    // main owns whatever is in the FP registers right now
+    fp_owner = main_thread;
+    fp_owner_dirty = (get_fs() == MSTATUS_FS_DIRTY);
+}
+
+void thread_create(thread_t *t, const char *name, void (*entry)(void),
+                   uint32_t *stack, uint32_t stack_words) {
+    // Build the frame context_switch pops: ra, s0-s11 (64 bytes)
+    uint32_t top = ((uint32_t)(stack + stack_words)) & ~15u;
+    uint32_t *frame = (uint32_t *)(top - 64);
+
+    for (int i = 0; i < 16; i++) {
+        frame[i] = 0;
+    }
+    frame[0] = (uint32_t)thread_bootstrap;  // ra
+    frame[1] = (uint32_t)entry;             // s0
+
+    t->sp = (uint32_t)frame;
+    t->name = name;
+    t->fp_saves = 0;
+    t->fp_restores = 0;
+
+    if (thread_count < MAX_THREADS) {
+        threads[thread_count++] = t;
+    }
+}
+
+void thread_yield(void) {
+    thread_t *prev = current_thread();
+    int next_index = (current_index + 1) % thread_count;
+    thread_t *next = threads[next_index];
+
+    if (next == prev) {
+        return;
+    }
+
+    if (fp_policy == FP_POLICY_EAGER) {
+        // Unconditional: 32 x fsd + frcsr, then 32 x fld + fscsr
+        fp_context_save(&prev->fp);
+        prev->fp_saves++;
+        fp_context_restore(&next->fp);
+        next->fp_restores++;
+    } else {
+        // Only the owner can run with FS != Off. Remember whether it
+        // dirtied the registers; the actual save is deferred until some
+        // other thread traps on its first FP instruction.
+        if (get_fs() == MSTATUS_FS_DIRTY) {
+            fp_owner_dirty = 1;
+        }
+
+        if (next == fp_owner) {
+            set_fs(fp_owner_dirty ? MSTATUS_FS_DIRTY : MSTATUS_FS_CLEAN);
+        } else {
+            set_fs(MSTATUS_FS_OFF);
+        }
+    }
+
+    current_index = next_index;
+    context_switch(&prev->sp, next->sp);
+}
+
+void fp_set_policy(fp_policy_t policy) {
+    thread_t *cur = current_thread();
+
+    // Make the current thread's FP state live so both policies start
+    // from the same point: every other thread's state is in memory.
+    if (fp_policy == FP_POLICY_LAZY && fp_owner != cur) {
+        if (get_fs() == MSTATUS_FS_DIRTY) {
+            fp_owner_dirty = 1;
+        }
+        set_fs(MSTATUS_FS_CLEAN);
+        if (fp_owner && fp_owner_dirty) {
+            fp_context_save(&fp_owner->fp);
+            fp_owner->fp_saves++;
+        }
+        fp_context_restore(&cur->fp);
+        cur->fp_restores++;
+    }
+
+    fp_policy = policy;
+    fp_owner = cur;
+    fp_owner_dirty = 1;         // Live registers have not been saved yet
+    set_fs(MSTATUS_FS_DIRTY);
+
+    if (policy == FP_POLICY_EAGER) {
+        write_csr(mtvec, (uint32_t)trap_entry_eager);
+    } else {
+        write_csr(mtvec, (uint32_t)trap_entry_lazy);
+    }
+}
+
+uint32_t fp_lazy_traps(void) {
+    return lazy_trap_count;
+}
+
+// Read the faulting instruction (mtval may be zero on some cores)
+static uint32_t fetch_insn(uint32_t pc) {
+    const volatile uint16_t *p = (const volatile uint16_t *)pc;
+    uint32_t lo = p[0];
+
+    if ((lo & 3) != 3) {
+        return lo;  // Compressed instruction
+    }
+    return lo | ((uint32_t)p[1] << 16);
+}
+
+// Does this instruction need the FPU (i.e. would trap with FS = Off)?
+static int insn_is_fp(uint32_t insn) {
+    if ((insn & 3) != 3) {
+        // RV32 quadrants 0/2 with odd funct3: C.FLD/C.FSD/C.FLW/C.FSW(SP)
+        uint32_t quadrant = insn & 3;
+        uint32_t funct3 = (insn >> 13) & 7;
+        return (quadrant == 0 || quadrant == 2) && (funct3 & 1);
+    }
+
+    switch (insn & 0x7F) {
+    case 0x07:  // LOAD-FP
+    case 0x27:  // STORE-FP
+    case 0x43:  // FMADD
+    case 0x47:  // FMSUB
+    case 0x4B:  // FNMSUB
+    case 0x4F:  // FNMADD
+    case 0x53:  // OP-FP
+        return 1;
+    case 0x73: {
+        // SYSTEM: CSR access to fflags (0x001), frm (0x002), fcsr (0x003)
+        uint32_t funct3 = (insn >> 12) & 7;
+        uint32_t csr = insn >> 20;
+        return funct3 != 0 && funct3 != 4 && csr >= 1 && csr <= 3;
+    }
+    default:
+        return 0;
+    }
+}
+
+// First FP instruction of a thread that does not own the FPU
+static void fp_lazy_restore(void) {
+    thread_t *cur = current_thread();
+
+    lazy_trap_count++;
+
+    if (fp_owner == cur) {
+        set_fs(fp_owner_dirty ? MSTATUS_FS_DIRTY : MSTATUS_FS_CLEAN);
+        return;
+    }
+
+    set_fs(MSTATUS_FS_CLEAN);   // FPU on for the save/restore itself
+    if (fp_owner && fp_owner_dirty) {
+        fp_context_save(&fp_owner->fp);
+        fp_owner->fp_saves++;
+    }
+    fp_context_restore(&cur->fp);
+    cur->fp_restores++;
+
+    // Registers now match cur->fp exactly
+    fp_owner = cur;
+    fp_owner_dirty = 0;
+    set_fs(MSTATUS_FS_CLEAN);
+}
+
+static void trap_fatal(uint32_t mcause, uint32_t mepc, uint32_t mtval) {
+    fatal_mcause = mcause;
+    fatal_mepc = mepc;
+    fatal_mtval = mtval;
+    while (1) {
+        asm volatile ("wfi");
+    }
+}
+
+// Called from trap_entry_lazy / trap_entry_eager with interrupts disabled
+void trap_dispatch(uint32_t mcause, uint32_t mepc, uint32_t mtval) {
+    if (mcause & MCAUSE_INTERRUPT) {
+        machine_irq_handler(MCAUSE_CODE(mcause));
+        return;
+    }
+
+    if (mcause == EXC_ILLEGAL_INSN &&
+        fp_policy == FP_POLICY_LAZY &&
+        get_fs() == MSTATUS_FS_OFF) {
+        uint32_t insn = mtval ? mtval : fetch_insn(mepc);
+        if (insn_is_fp(insn)) {
+            fp_lazy_restore();  // mepc unchanged: the FP instruction re-executes
+            return;
+        }
+    }
+
+    trap_fatal(mcause, mepc, mtval);
+}
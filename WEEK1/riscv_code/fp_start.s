@@ -0,0 +1,34 @@
+.section .text.start
+.global _start
+
+_start:
+    # Set up stack pointer
+    lui sp, %hi(_stack_top)
+    addi sp, sp, %lo(_stack_top)
+
+    # Initialize BSS section
+    la t0, _bss_start
+    la t1, _bss_end
+bss_loop:
+    bge t0, t1, bss_done
+    sw zero, 0(t0)
+    addi t0, t0, 4
+    j bss_loop
+bss_done:
+
+    # Turn the FPU on (mstatus.FS = Initial); FS resets to Off and any
+    # ilp32d code would otherwise take an illegal-instruction trap
+    li t0, (1 << 13)
+    csrs mstatus, t0
+
+    # Install lazy trap entry (direct mode)
+    la t0, trap_entry_lazy
+    csrw mtvec, t0
+
+    # Call main program
+    call main
+
+    # Infinite loop
+1:  j 1b
+
+.size _start, . - _start
@@ -2,31 +2,34 @@
 #define GPIO_HAL_H
 
 #include <stdint.h>
+#include "regmap.h"
 
-// GPIO register addresses (SiFive FE310-like layout)
-#define GPIO_BASE       0x10012000
-#define GPIO_INPUT_VAL  (GPIO_BASE + 0x00)  // GPIO input value
-#define GPIO_INPUT_EN   (GPIO_BASE + 0x04)  // GPIO input enable
-#define GPIO_OUTPUT_EN  (GPIO_BASE + 0x08)  // GPIO output enable
-#define GPIO_OUTPUT_VAL (GPIO_BASE + 0x0C)  // GPIO output value
-#define GPIO_PUE        (GPIO_BASE + 0x10)  // GPIO pull-up enable
-#define GPIO_DS         (GPIO_BASE + 0x14)  // GPIO drive strength
-#define GPIO_RISE_IE    (GPIO_BASE + 0x18)  // GPIO rise interrupt enable
-#define GPIO_RISE_IP    (GPIO_BASE + 0x1C)  // GPIO rise interrupt pending
-#define GPIO_FALL_IE    (GPIO_BASE + 0x20)  // GPIO fall interrupt enable
-#define GPIO_FALL_IP    (GPIO_BASE + 0x24)  // GPIO fall interrupt pending
-#define GPIO_HIGH_IE    (GPIO_BASE + 0x28)  // GPIO high interrupt enable
-#define GPIO_HIGH_IP    (GPIO_BASE + 0x2C)  // GPIO high interrupt pending
-#define GPIO_LOW_IE     (GPIO_BASE + 0x30)  // GPIO low interrupt enable
-#define GPIO_LOW_IP     (GPIO_BASE + 0x34)  // GPIO low interrupt pending
-#define GPIO_IOF_EN     (GPIO_BASE + 0x38)  // GPIO I/O function enable
-#define GPIO_IOF_SEL    (GPIO_BASE + 0x3C)  // GPIO I/O function select
-#define GPIO_OUT_XOR    (GPIO_BASE + 0x40)  // GPIO output XOR
+// GPIO register addresses (SiFive FE310-like layout), from regmap.h
+#define GPIO_INPUT_VAL  REG_ADDR(gpio_input_val)   // GPIO input value
+#define GPIO_INPUT_EN   REG_ADDR(gpio_input_en)    // GPIO input enable
+#define GPIO_OUTPUT_EN  REG_ADDR(gpio_output_en)   // GPIO output enable
+#define GPIO_OUTPUT_VAL REG_ADDR(gpio_output_val)  // GPIO output value
+#define GPIO_PUE        REG_ADDR(gpio_pue)         // GPIO pull-up enable
+#define GPIO_DS         REG_ADDR(gpio_ds)          // GPIO drive strength
+#define GPIO_RISE_IE    REG_ADDR(gpio_rise_ie)     // GPIO rise interrupt enable
+#define GPIO_RISE_IP    REG_ADDR(gpio_rise_ip)     // GPIO rise interrupt pending
+#define GPIO_FALL_IE    REG_ADDR(gpio_fall_ie)     // GPIO fall interrupt enable
+#define GPIO_FALL_IP    REG_ADDR(gpio_fall_ip)     // GPIO fall interrupt pending
+#define GPIO_HIGH_IE    REG_ADDR(gpio_high_ie)     // GPIO high interrupt enable
+#define GPIO_HIGH_IP    REG_ADDR(gpio_high_ip)     // GPIO high interrupt pending
+#define GPIO_LOW_IE     REG_ADDR(gpio_low_ie)      // GPIO low interrupt enable
+#define GPIO_LOW_IP     REG_ADDR(gpio_low_ip)      // GPIO low interrupt pending
+#define GPIO_IOF_EN     REG_ADDR(gpio_iof_en)      // GPIO I/O function enable
+#define GPIO_IOF_SEL    REG_ADDR(gpio_iof_sel)     // GPIO I/O function select
+#define GPIO_OUT_XOR    REG_ADDR(gpio_out_xor)     // GPIO output XOR
+
+// PLIC source of GPIO pin n is GPIO_IRQ_BASE + n (FE310 / QEMU sifive_e)
+#define GPIO_IRQ_BASE   8
 
 // LED pin definitions
-#define LED_PIN_RED     22  // Red LED on pin 22
-#define LED_PIN_GREEN   19  // Green LED on pin 19
-#define LED_PIN_BLUE    21  // Blue LED on pin 21
+#define LED_PIN_RED     FIELD_SHIFT(gpio_output_val, red)   // Red LED on pin 22
+#define LED_PIN_GREEN   FIELD_SHIFT(gpio_output_val, green) // Green LED on pin 19
+#define LED_PIN_BLUE    FIELD_SHIFT(gpio_output_val, blue)  // Blue LED on pin 21
 
 // GPIO control macros
 #define GPIO_SET_BIT(reg, pin)   (*((volatile uint32_t*)(reg)) |= (1 << (pin)))
@@ -0,0 +1,87 @@
+#include <stdint.h>
+#include "irq_nest.h"
+#include "plic.h"
+#include "riscv_csr.h"
+
+static irq_handler_t handlers[IRQ_MAX_SOURCES];
+static uint8_t priorities[IRQ_MAX_SOURCES];
+static int nesting_enabled = 0;
+static volatile uint32_t depth = 0;
+static irq_stats_t stats;
+
+void irq_register(uint32_t irq, uint32_t priority, irq_handler_t handler) {
+    if (irq == 0 || irq >= IRQ_MAX_SOURCES) {
+        return;
+    }
+    handlers[irq] = handler;
+    priorities[irq] = (uint8_t)priority;
+    plic_set_priority(irq, priority);
+    plic_enable(PLIC_CTX_M_HART0, irq);
+}
+
+void irq_set_nesting(int enabled) {
+    nesting_enabled = enabled;
+}
+
+void irq_enable_external(void) {
+    plic_set_threshold(PLIC_CTX_M_HART0, 0);
+    set_csr(mie, MIP_MEIP);
+    set_csr(mstatus, MSTATUS_MIE);
+}
+
+void irq_external_dispatch(void) {
+    // A nested trap overwrites mepc and mstatus.MPIE/MPP: keep our copies
+    uint32_t saved_epc = read_csr(mepc);
+    uint32_t saved_status = read_csr(mstatus);
+    uint32_t saved_threshold = plic_get_threshold(PLIC_CTX_M_HART0);
+
+    uint32_t irq = plic_claim(PLIC_CTX_M_HART0);
+    if (irq == 0) {
+        stats.spurious++;
+        return;
+    }
+
+    stats.taken++;
+    if (depth > 0) {
+        stats.nested++;
+    }
+    depth++;
+    if (depth > stats.max_depth) {
+        stats.max_depth = depth;
+    }
+
+    // Mask this priority and everything below it before opening up
+    uint32_t priority = (irq < IRQ_MAX_SOURCES) ? priorities[irq] : PLIC_MAX_PRIORITY;
+    plic_set_threshold(PLIC_CTX_M_HART0, priority);
+
+    if (nesting_enabled) {
+        set_csr(mstatus, MSTATUS_MIE);
+    }
+
+    if (irq < IRQ_MAX_SOURCES && handlers[irq]) {
+        handlers[irq](irq);
+    }
+
+    // Unwind in reverse: close, complete, restore threshold and trap state
+    clear_csr(mstatus, MSTATUS_MIE);
+    depth--;
+    plic_complete(PLIC_CTX_M_HART0, irq);
+    plic_set_threshold(PLIC_CTX_M_HART0, saved_threshold);
+    write_csr(mepc, saved_epc);
+    write_csr(mstatus, saved_status);
+}
+
+uint32_t irq_depth(void) {
+    return depth;
+}
+
+void irq_get_stats(irq_stats_t *out) {
+    *out = stats;
+}
+
+void irq_reset_stats(void) {
+    stats.taken = 0;
+    stats.nested = 0;
+    stats.max_depth = 0;
+    stats.spurious = 0;
+}
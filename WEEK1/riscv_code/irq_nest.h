@@ -0,0 +1,40 @@
+#ifndef IRQ_NEST_H
+#define IRQ_NEST_H
+
+#include <stdint.h>
+
+// Priority-preemptive PLIC dispatch for machine mode.
+// While a source is in service the PLIC threshold is raised to its
+// priority, so only strictly higher-priority sources can interrupt it.
+// With nesting enabled, mstatus.MIE is turned back on around the handler.
+
+#define IRQ_MAX_SOURCES 64
+
+typedef void (*irq_handler_t)(uint32_t irq);
+
+typedef struct {
+    uint32_t taken;         // External interrupts dispatched
+    uint32_t nested;        // ... of which preempted another handler
+    uint32_t max_depth;     // Deepest handler nesting seen
+    uint32_t spurious;      // Claims that returned 0
+} irq_stats_t;
+
+// Set priority (1..PLIC_MAX_PRIORITY), install handler, enable the source
+void irq_register(uint32_t irq, uint32_t priority, irq_handler_t handler);
+
+// Nesting on: handlers run with MIE set (default off)
+void irq_set_nesting(int enabled);
+
+// Enable mie.MEIE and mstatus.MIE, threshold 0
+void irq_enable_external(void);
+
+// Call from trap_dispatch() for mcause == MCAUSE_INTERRUPT | IRQ_M_EXT.
+// Saves mepc/mstatus and the threshold, claims, runs the handler and
+// unwinds in reverse order, so it may be re-entered by a nested trap.
+void irq_external_dispatch(void);
+
+uint32_t irq_depth(void);
+void irq_get_stats(irq_stats_t *stats);
+void irq_reset_stats(void);
+
+#endif /* IRQ_NEST_H */
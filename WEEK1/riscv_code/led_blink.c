@@ -1,4 +1,5 @@
 #include "gpio_hal.h"
+#include "stack.h"
 
 // Global variables for LED state
 volatile uint32_t led_counter = 0;
@@ -7,19 +8,13 @@ volatile uint8_t current_led = 0;
 // Initialize GPIO for LED control
 void gpio_init(void) {
     // Set LED pins as outputs
-    GPIO_SET_BIT(GPIO_OUTPUT_EN, LED_PIN_RED);
-    GPIO_SET_BIT(GPIO_OUTPUT_EN, LED_PIN_GREEN);
-    GPIO_SET_BIT(GPIO_OUTPUT_EN, LED_PIN_BLUE);
-    
+    reg_modify(gpio_output_en, (red, 1), (green, 1), (blue, 1));
+
     // Clear all LEDs initially (LEDs are active low)
-    GPIO_SET_BIT(GPIO_OUTPUT_VAL, LED_PIN_RED);
-    GPIO_SET_BIT(GPIO_OUTPUT_VAL, LED_PIN_GREEN);
-    GPIO_SET_BIT(GPIO_OUTPUT_VAL, LED_PIN_BLUE);
-    
+    reg_modify(gpio_output_val, (red, 1), (green, 1), (blue, 1));
+
     // Disable I/O functions (use as GPIO)
-    GPIO_CLEAR_BIT(GPIO_IOF_EN, LED_PIN_RED);
-    GPIO_CLEAR_BIT(GPIO_IOF_EN, LED_PIN_GREEN);
-    GPIO_CLEAR_BIT(GPIO_IOF_EN, LED_PIN_BLUE);
+    reg_modify(gpio_iof_en, (red, 0), (green, 0), (blue, 0));
 }
 
 // Simple delay function
@@ -82,10 +77,27 @@ void led_sequence_2(void) {
     delay(300000);
 }
 
+// Any trap (a stack running into its PMP guard): red LED on, stop
+void trap_dispatch(uint32_t mcause, uint32_t mepc, uint32_t mtval) {
+    (void)mcause;
+    (void)mepc;
+    (void)mtval;
+    all_leds_off();
+    led_on(LED_PIN_RED);
+    while (1) {
+        asm volatile ("wfi");
+    }
+}
+
 // Main program
 void main(void) {
     // Initialize GPIO system
     gpio_init();
+
+    // Stacks are painted by stack_start.s; fault on the first store below them
+    stack_register_boot();
+    stack_guard_pmp(0, _stack_guard);
+    stack_guard_pmp(1, _isr_stack_guard);
     
     // Main LED blink loop
     while (1) {
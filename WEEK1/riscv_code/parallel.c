@@ -0,0 +1,209 @@
+#include <stdint.h>
+#include "parallel.h"
+#include "smp.h"
+#include "wsdeque.h"
+
+#define STEAL_TRIES     4       // Victims tried before re-checking for the end
+
+typedef struct {
+    wsdeque_t dq;
+    par_stats_t stats;
+    uint32_t partial;           // parallel_reduce: this hart's result so far
+    uint32_t rng;               // Victim selection (xorshift)
+    volatile uint32_t posted;   // Job generation handed to this hart
+    volatile uint32_t done;     // Job generation this hart has left
+} __attribute__((aligned(64))) par_hart_t;
+
+typedef struct {
+    par_for_fn_t for_fn;
+    par_reduce_fn_t reduce_fn;
+    par_combine_fn_t combine;
+    void *ctx;
+    uint32_t grain;
+    uint32_t workers;
+    uint32_t remaining;         // Iterations not yet run (atomic)
+    uint32_t gen;
+} par_job_t;
+
+static par_hart_t harts[SMP_MAX_HARTS];
+static par_job_t job;
+static uint32_t online = 1;
+static uint32_t workers = 1;
+
+static uint32_t next_victim(par_hart_t *me, uint32_t self) {
+    uint32_t x = me->rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    me->rng = x;
+
+    // Any worker but ourselves
+    uint32_t v = x % (job.workers - 1);
+    return v >= self ? v + 1 : v;
+}
+
+static void run_range(par_hart_t *me, ws_item_t it) {
+    uint32_t lo = it.lo;
+    uint32_t hi = it.hi;
+
+    while (hi - lo > job.grain) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        ws_item_t upper = { mid, hi };
+        if (!wsdeque_push(&me->dq, upper)) {
+            me->stats.full++;
+            break;
+        }
+        me->stats.splits++;
+        hi = mid;
+    }
+
+    if (job.reduce_fn) {
+        me->partial = job.combine(me->partial, job.reduce_fn(job.ctx, lo, hi));
+    } else {
+        job.for_fn(job.ctx, lo, hi);
+    }
+    me->stats.ranges++;
+    __atomic_fetch_sub(&job.remaining, hi - lo, __ATOMIC_RELEASE);
+}
+
+static int steal_some(par_hart_t *me, uint32_t self, ws_item_t *it) {
+    if (job.workers < 2) {
+        return 0;
+    }
+    for (int i = 0; i < STEAL_TRIES; i++) {
+        uint32_t v = next_victim(me, self);
+        if (wsdeque_steal(&harts[v].dq, it) == WS_OK) {
+            me->stats.steals++;
+            return 1;
+        }
+        me->stats.steal_fails++;
+    }
+    return 0;
+}
+
+// Run own work, then steal, until the whole job is finished
+static void participate(uint32_t self) {
+    par_hart_t *me = &harts[self];
+    ws_item_t it;
+
+    for (;;) {
+        if (wsdeque_pop(&me->dq, &it) || steal_some(me, self, &it)) {
+            run_range(me, it);
+        } else if (__atomic_load_n(&job.remaining, __ATOMIC_ACQUIRE) == 0) {
+            return;
+        }
+    }
+}
+
+static void worker_main(uint32_t self) {
+    par_hart_t *me = &harts[self];
+
+    for (;;) {
+        uint32_t gen = __atomic_load_n(&me->posted, __ATOMIC_ACQUIRE);
+        if (gen != me->done) {
+            participate(self);
+            __atomic_store_n(&me->done, gen, __ATOMIC_RELEASE);
+        } else {
+            smp_sleep();
+        }
+    }
+}
+
+uint32_t parallel_init(void) {
+    online = smp_boot();
+    workers = online;
+
+    for (uint32_t h = 0; h < SMP_MAX_HARTS; h++) {
+        wsdeque_init(&harts[h].dq);
+        harts[h].rng = 0x9E3779B9u * (h + 1);
+        harts[h].posted = 0;
+        harts[h].done = 0;
+    }
+    parallel_reset_stats();
+
+    smp_start_secondaries(worker_main);
+    return online;
+}
+
+void parallel_set_workers(uint32_t n) {
+    if (n < 1) n = 1;
+    if (n > online) n = online;
+    workers = n;
+}
+
+uint32_t parallel_workers(void) {
+    return workers;
+}
+
+static void run_job(uint32_t begin, uint32_t end) {
+    ws_item_t all = { begin, end };
+
+    job.workers = workers;
+    job.remaining = end - begin;
+    job.gen++;
+    wsdeque_push(&harts[0].dq, all);
+
+    // Hand the job to the helpers; the release store publishes job.*
+    for (uint32_t h = 1; h < job.workers; h++) {
+        __atomic_store_n(&harts[h].posted, job.gen, __ATOMIC_RELEASE);
+        smp_wake(h);
+    }
+
+    participate(0);
+
+    // Helpers may still be inside a steal attempt: job.* must not change
+    // until every one of them has left
+    for (uint32_t h = 1; h < job.workers; h++) {
+        while (__atomic_load_n(&harts[h].done, __ATOMIC_ACQUIRE) != job.gen) {
+        }
+    }
+}
+
+void parallel_for(uint32_t begin, uint32_t end, uint32_t grain,
+                  par_for_fn_t fn, void *ctx) {
+    if (end <= begin) {
+        return;
+    }
+    job.for_fn = fn;
+    job.reduce_fn = 0;
+    job.ctx = ctx;
+    job.grain = grain ? grain : 1;
+    run_job(begin, end);
+}
+
+uint32_t parallel_reduce(uint32_t begin, uint32_t end, uint32_t grain,
+                         par_reduce_fn_t fn, par_combine_fn_t combine,
+                         uint32_t identity, void *ctx) {
+    if (end <= begin) {
+        return identity;
+    }
+    job.for_fn = 0;
+    job.reduce_fn = fn;
+    job.combine = combine;
+    job.ctx = ctx;
+    job.grain = grain ? grain : 1;
+    for (uint32_t h = 0; h < workers; h++) {
+        harts[h].partial = identity;
+    }
+    run_job(begin, end);
+
+    uint32_t result = identity;
+    for (uint32_t h = 0; h < job.workers; h++) {
+        result = combine(result, harts[h].partial);
+    }
+    return result;
+}
+
+void parallel_get_stats(uint32_t hart, par_stats_t *stats) {
+    *stats = harts[hart].stats;
+}
+
+void parallel_reset_stats(void) {
+    for (uint32_t h = 0; h < SMP_MAX_HARTS; h++) {
+        harts[h].stats.ranges = 0;
+        harts[h].stats.splits = 0;
+        harts[h].stats.steals = 0;
+        harts[h].stats.steal_fails = 0;
+        harts[h].stats.full = 0;
+    }
+}
@@ -0,0 +1,46 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <stdint.h>
+#include "smp.h"
+
+// Data-parallel loops over all harts with work stealing.
+//
+// The range [begin, end) starts on hart 0's deque. Whoever runs a range
+// larger than the grain splits it in half, pushes the upper half on its
+// own deque and continues with the lower half; idle harts steal the
+// oldest (largest) halves from random victims. A call returns when every
+// iteration has run, on the calling hart (hart 0).
+
+typedef void (*par_for_fn_t)(void *ctx, uint32_t lo, uint32_t hi);
+typedef uint32_t (*par_reduce_fn_t)(void *ctx, uint32_t lo, uint32_t hi);
+typedef uint32_t (*par_combine_fn_t)(uint32_t a, uint32_t b);
+
+typedef struct {
+    uint32_t ranges;        // Ranges executed
+    uint32_t splits;        // Halves pushed for others to steal
+    uint32_t steals;        // Successful steals
+    uint32_t steal_fails;   // Empty victim or lost the race
+    uint32_t full;          // Deque full, ran the range unsplit
+} par_stats_t;
+
+// Hart 0: bring up the secondaries, returns the number of harts online
+uint32_t parallel_init(void);
+
+// Use harts 0..n-1 for the following calls (1..online)
+void parallel_set_workers(uint32_t n);
+uint32_t parallel_workers(void);
+
+void parallel_for(uint32_t begin, uint32_t end, uint32_t grain,
+                  par_for_fn_t fn, void *ctx);
+
+// combine must be associative and commutative: the order in which the
+// partial results meet depends on who stole what
+uint32_t parallel_reduce(uint32_t begin, uint32_t end, uint32_t grain,
+                         par_reduce_fn_t fn, par_combine_fn_t combine,
+                         uint32_t identity, void *ctx);
+
+void parallel_get_stats(uint32_t hart, par_stats_t *stats);
+void parallel_reset_stats(void);
+
+#endif /* PARALLEL_H */
@@ -0,0 +1,54 @@
+#ifndef PLIC_H
+#define PLIC_H
+
+#include <stdint.h>
+
+// Platform-Level Interrupt Controller (QEMU virt machine)
+#define PLIC_BASE           0x0C000000
+#define PLIC_PRIORITY(irq)  (PLIC_BASE + 0x000000 + 4 * (irq))
+#define PLIC_PENDING        (PLIC_BASE + 0x001000)
+#define PLIC_ENABLE(ctx)    (PLIC_BASE + 0x002000 + 0x80 * (ctx))
+#define PLIC_THRESHOLD(ctx) (PLIC_BASE + 0x200000 + 0x1000 * (ctx))
+#define PLIC_CLAIM(ctx)     (PLIC_BASE + 0x200004 + 0x1000 * (ctx))
+
+// Context 0 is hart 0 machine mode on QEMU virt (context 1 is S-mode)
+#define PLIC_CTX_M_HART0    0
+
+// Interrupt sources on QEMU virt
+#define UART0_IRQ           10
+#define RTC_IRQ             11      // Goldfish RTC alarm
+
+#define PLIC_MAX_PRIORITY   7       // QEMU virt implements priorities 0-7
+
+#define PLIC_REG(addr)      (*(volatile uint32_t *)(addr))
+
+static inline void plic_set_priority(uint32_t irq, uint32_t priority) {
+    PLIC_REG(PLIC_PRIORITY(irq)) = priority;
+}
+
+static inline void plic_enable(uint32_t ctx, uint32_t irq) {
+    PLIC_REG(PLIC_ENABLE(ctx) + 4 * (irq / 32)) |= (1u << (irq % 32));
+}
+
+static inline void plic_set_threshold(uint32_t ctx, uint32_t threshold) {
+    PLIC_REG(PLIC_THRESHOLD(ctx)) = threshold;
+}
+
+static inline uint32_t plic_get_priority(uint32_t irq) {
+    return PLIC_REG(PLIC_PRIORITY(irq));
+}
+
+static inline uint32_t plic_get_threshold(uint32_t ctx) {
+    return PLIC_REG(PLIC_THRESHOLD(ctx));
+}
+
+// Returns the highest-priority pending source (0 = none) and marks it in service
+static inline uint32_t plic_claim(uint32_t ctx) {
+    return PLIC_REG(PLIC_CLAIM(ctx));
+}
+
+static inline void plic_complete(uint32_t ctx, uint32_t irq) {
+    PLIC_REG(PLIC_CLAIM(ctx)) = irq;
+}
+
+#endif /* PLIC_H */
@@ -0,0 +1,137 @@
+#ifndef REG_H
+#define REG_H
+
+#include <stdint.h>
+
+// Typed register access, checked at compile time.
+//
+// A register is declared once as REGDEF_<reg> (address, C type, access,
+// reset value) and each field as FIELD_<reg>_<field> (shift, width,
+// access); see regmap.h. Accesses name the register and fields:
+//
+//   reg_modify(gpio_output_en, (red, 1), (green, 1), (blue, 1));
+//   reg_write(sifive_uart_txctrl, (txen, 1), (nstop, 0));
+//   uint32_t full = reg_get(sifive_uart_txdata, full);
+//
+// All masks and shifts are integer constant expressions, so any number of
+// fields folds into one mask and one value: reg_modify is a single load
+// and a single store, reg_write a single store. An unknown field does not
+// compile (undeclared FIELD_<reg>_<field>), and neither does writing a
+// read-only register or field, reading a write-only one, or a
+// read-modify-write of a register whose writes have side effects
+// (REG_W1C, REG_PUSH) (_Static_assert). Values are masked to the field
+// width.
+//
+// Up to 8 fields per access. The statement expressions are GNU C, as in
+// riscv_csr.h.
+
+#define REG_R               1
+#define REG_W               2
+#define REG_RW              (REG_R | REG_W)
+#define REG_W1C             (REG_RW | 4)    // Write 1 to clear
+#define REG_PUSH            (REG_RW | 8)    // A write enqueues (FIFO)
+
+// ---- Descriptor access -------------------------------------------------------
+
+#define REG_ARG0_(a, b, c, d)   a
+#define REG_ARG1_(a, b, c, d)   b
+#define REG_ARG2_(a, b, c, d)   c
+#define REG_ARG3_(a, b, c, d)   d
+#define REG_ARG0(...)           REG_ARG0_(__VA_ARGS__)
+#define REG_ARG1(...)           REG_ARG1_(__VA_ARGS__)
+#define REG_ARG2(...)           REG_ARG2_(__VA_ARGS__)
+#define REG_ARG3(...)           REG_ARG3_(__VA_ARGS__)
+#define REG_FARG0_(a, b, c)     a
+#define REG_FARG1_(a, b, c)     b
+#define REG_FARG2_(a, b, c)     c
+#define REG_FARG0(...)          REG_FARG0_(__VA_ARGS__)
+#define REG_FARG1(...)          REG_FARG1_(__VA_ARGS__)
+#define REG_FARG2(...)          REG_FARG2_(__VA_ARGS__)
+
+#define REG_ADDR(r)             REG_ARG0(REGDEF_##r)
+#define REG_TYPE(r)             REG_ARG1(REGDEF_##r)
+#define REG_ACCESS(r)           REG_ARG2(REGDEF_##r)
+#define REG_RESET(r)            REG_ARG3(REGDEF_##r)
+#define REG_PTR(r)              ((volatile REG_TYPE(r) *)(REG_ADDR(r)))
+
+#define FIELD_SHIFT(r, f)       REG_FARG0(FIELD_##r##_##f)
+#define FIELD_WIDTH(r, f)       REG_FARG1(FIELD_##r##_##f)
+#define FIELD_ACCESS(r, f)      REG_FARG2(FIELD_##r##_##f)
+#define FIELD_MASK(r, f)        \
+    ((uint32_t)(0xFFFFFFFFu >> (32 - FIELD_WIDTH(r, f))) << FIELD_SHIFT(r, f))
+#define FIELD_VAL(r, f, v)      \
+    (((uint32_t)(v) << FIELD_SHIFT(r, f)) & FIELD_MASK(r, f))
+
+// ---- Field lists -------------------------------------------------------------
+
+#define REG_UNPAREN(...)        __VA_ARGS__
+
+// (f, v) -> "| mask" or "| value"; OR-ing a list of these combines them
+#define REG_MASK_(r, f, v)      FIELD_MASK(r, f)
+#define REG_MASK_F(...)         REG_MASK_(__VA_ARGS__)
+#define REG_OR_MASK(r, fv)      | REG_MASK_F(r, REG_UNPAREN fv)
+#define REG_VAL_F(...)          FIELD_VAL(__VA_ARGS__)
+#define REG_OR_VAL(r, fv)       | REG_VAL_F(r, REG_UNPAREN fv)
+
+#define REG_CHECK_W_(r, f, v)   \
+    _Static_assert(FIELD_ACCESS(r, f) & REG_W, "field " #f " of " #r " is read-only");
+#define REG_CHECK_W_F(...)      REG_CHECK_W_(__VA_ARGS__)
+#define REG_CHECK_W(r, fv)      REG_CHECK_W_F(r, REG_UNPAREN fv)
+
+#define REG_FE_1(m, r, x)       m(r, x)
+#define REG_FE_2(m, r, x, ...)  m(r, x) REG_FE_1(m, r, __VA_ARGS__)
+#define REG_FE_3(m, r, x, ...)  m(r, x) REG_FE_2(m, r, __VA_ARGS__)
+#define REG_FE_4(m, r, x, ...)  m(r, x) REG_FE_3(m, r, __VA_ARGS__)
+#define REG_FE_5(m, r, x, ...)  m(r, x) REG_FE_4(m, r, __VA_ARGS__)
+#define REG_FE_6(m, r, x, ...)  m(r, x) REG_FE_5(m, r, __VA_ARGS__)
+#define REG_FE_7(m, r, x, ...)  m(r, x) REG_FE_6(m, r, __VA_ARGS__)
+#define REG_FE_8(m, r, x, ...)  m(r, x) REG_FE_7(m, r, __VA_ARGS__)
+#define REG_FE_PICK(_1, _2, _3, _4, _5, _6, _7, _8, n, ...) REG_FE_##n
+#define REG_FOR_EACH(m, r, ...) \
+    REG_FE_PICK(__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)(m, r, __VA_ARGS__)
+
+// Combined mask and value of a field list
+#define REG_MASKS(r, ...)       (0u REG_FOR_EACH(REG_OR_MASK, r, __VA_ARGS__))
+#define REG_VALUES(r, ...)      (0u REG_FOR_EACH(REG_OR_VAL, r, __VA_ARGS__))
+
+// ---- Accessors ---------------------------------------------------------------
+
+// Whole register
+#define reg_read(r) ({                                                  \
+    _Static_assert(REG_ACCESS(r) & REG_R, #r " is write-only");         \
+    *REG_PTR(r);                                                        \
+})
+
+// One field, read from the register
+#define reg_get(r, f) ({                                                \
+    _Static_assert(REG_ACCESS(r) & REG_R, #r " is write-only");         \
+    _Static_assert(FIELD_ACCESS(r, f) & REG_R, "field " #f " of " #r " is write-only"); \
+    (uint32_t)((*REG_PTR(r) & FIELD_MASK(r, f)) >> FIELD_SHIFT(r, f)); \
+})
+
+// One field, extracted from a value read earlier (no access)
+#define reg_field(r, f, val)    \
+    ((uint32_t)(((val) & FIELD_MASK(r, f)) >> FIELD_SHIFT(r, f)))
+
+// Store the listed fields, all others at their reset value. No read.
+#define reg_write(r, ...) ({                                            \
+    _Static_assert(REG_ACCESS(r) & REG_W, #r " is read-only");          \
+    REG_FOR_EACH(REG_CHECK_W, r, __VA_ARGS__)                           \
+    *REG_PTR(r) = (REG_TYPE(r))(((uint32_t)REG_RESET(r) &               \
+                  ~REG_MASKS(r, __VA_ARGS__)) | REG_VALUES(r, __VA_ARGS__)); \
+})
+
+// Change the listed fields, keep the others: one load, one store. Not
+// for W1C or FIFO registers: writing back what was read would clear every
+// pending bit, or push a byte.
+#define reg_modify(r, ...) ({                                           \
+    _Static_assert(REG_ACCESS(r) != REG_W1C, #r " is write-1-to-clear, use reg_write"); \
+    _Static_assert(REG_ACCESS(r) != REG_PUSH, #r " is a FIFO, use reg_write"); \
+    _Static_assert(REG_ACCESS(r) == REG_RW, #r " is not read-write");   \
+    REG_FOR_EACH(REG_CHECK_W, r, __VA_ARGS__)                           \
+    volatile REG_TYPE(r) *reg_p_ = REG_PTR(r);                          \
+    *reg_p_ = (REG_TYPE(r))((*reg_p_ & ~REG_MASKS(r, __VA_ARGS__)) |    \
+                            REG_VALUES(r, __VA_ARGS__));                \
+})
+
+#endif /* REG_H */
@@ -0,0 +1,153 @@
+#ifndef REGMAP_H
+#define REGMAP_H
+
+#include <stdint.h>
+#include "reg.h"
+
+// Register map: every peripheral register used by the tasks, declared
+// once. gpio_hal.h, sifive_uart.h, uart_rx.h, clocksource.h and runtime.h
+// take their addresses from here.
+//
+//   REGDEF_<reg>          address, C type, access, reset value
+//                         (REG_W1C: pending bits cleared by writing 1,
+//                          REG_PUSH: a write enqueues into a FIFO)
+//   FIELD_<reg>_<field>   shift, width, access
+
+#define GPIO_BASE           0x10012000  // SiFive GPIO (FE310 / QEMU sifive_e)
+#define SIFIVE_UART0_BASE   0x10013000  // SiFive UART0 (FE310 / QEMU sifive_e)
+#define NS16550_BASE        0x10000000  // 16550 UART (QEMU virt)
+#define CLINT_BASE          0x02000000  // Core-local interruptor (both)
+
+// ---- SiFive GPIO: one bit per pin ------------------------------------------
+
+#define REGDEF_gpio_input_val   (GPIO_BASE + 0x00), uint32_t, REG_R,  0
+#define REGDEF_gpio_input_en    (GPIO_BASE + 0x04), uint32_t, REG_RW, 0
+#define REGDEF_gpio_output_en   (GPIO_BASE + 0x08), uint32_t, REG_RW, 0
+#define REGDEF_gpio_output_val  (GPIO_BASE + 0x0C), uint32_t, REG_RW, 0
+#define REGDEF_gpio_pue         (GPIO_BASE + 0x10), uint32_t, REG_RW, 0
+#define REGDEF_gpio_ds          (GPIO_BASE + 0x14), uint32_t, REG_RW, 0
+#define REGDEF_gpio_rise_ie     (GPIO_BASE + 0x18), uint32_t, REG_RW, 0
+#define REGDEF_gpio_rise_ip     (GPIO_BASE + 0x1C), uint32_t, REG_W1C, 0
+#define REGDEF_gpio_fall_ie     (GPIO_BASE + 0x20), uint32_t, REG_RW, 0
+#define REGDEF_gpio_fall_ip     (GPIO_BASE + 0x24), uint32_t, REG_W1C, 0
+#define REGDEF_gpio_high_ie     (GPIO_BASE + 0x28), uint32_t, REG_RW, 0
+#define REGDEF_gpio_high_ip     (GPIO_BASE + 0x2C), uint32_t, REG_W1C, 0
+#define REGDEF_gpio_low_ie      (GPIO_BASE + 0x30), uint32_t, REG_RW, 0
+#define REGDEF_gpio_low_ip      (GPIO_BASE + 0x34), uint32_t, REG_W1C, 0
+#define REGDEF_gpio_iof_en      (GPIO_BASE + 0x38), uint32_t, REG_RW, 0
+#define REGDEF_gpio_iof_sel     (GPIO_BASE + 0x3C), uint32_t, REG_RW, 0
+#define REGDEF_gpio_out_xor     (GPIO_BASE + 0x40), uint32_t, REG_RW, 0
+
+// LED pins (HiFive1 RGB LED) as fields of the per-pin registers
+#define GPIO_PIN_RED        22, 1, REG_RW
+#define GPIO_PIN_GREEN      19, 1, REG_RW
+#define GPIO_PIN_BLUE       21, 1, REG_RW
+#define GPIO_PIN_ALL        0, 32, REG_RW
+#define GPIO_PIN_IN(pin)    pin, 1, REG_R
+
+#define FIELD_gpio_input_val_red    GPIO_PIN_IN(22)
+#define FIELD_gpio_input_val_green  GPIO_PIN_IN(19)
+#define FIELD_gpio_input_val_blue   GPIO_PIN_IN(21)
+#define FIELD_gpio_input_val_all    0, 32, REG_R
+#define FIELD_gpio_input_en_red     GPIO_PIN_RED
+#define FIELD_gpio_input_en_green   GPIO_PIN_GREEN
+#define FIELD_gpio_input_en_blue    GPIO_PIN_BLUE
+#define FIELD_gpio_output_en_red    GPIO_PIN_RED
+#define FIELD_gpio_output_en_green  GPIO_PIN_GREEN
+#define FIELD_gpio_output_en_blue   GPIO_PIN_BLUE
+#define FIELD_gpio_output_en_all    GPIO_PIN_ALL
+#define FIELD_gpio_output_val_red   GPIO_PIN_RED
+#define FIELD_gpio_output_val_green GPIO_PIN_GREEN
+#define FIELD_gpio_output_val_blue  GPIO_PIN_BLUE
+#define FIELD_gpio_output_val_all   GPIO_PIN_ALL
+#define FIELD_gpio_iof_en_red       GPIO_PIN_RED
+#define FIELD_gpio_iof_en_green     GPIO_PIN_GREEN
+#define FIELD_gpio_iof_en_blue      GPIO_PIN_BLUE
+#define FIELD_gpio_out_xor_red      GPIO_PIN_RED
+#define FIELD_gpio_out_xor_green    GPIO_PIN_GREEN
+#define FIELD_gpio_out_xor_blue     GPIO_PIN_BLUE
+#define FIELD_gpio_out_xor_all      GPIO_PIN_ALL
+#define FIELD_gpio_rise_ip_red      GPIO_PIN_RED
+#define FIELD_gpio_rise_ip_green    GPIO_PIN_GREEN
+#define FIELD_gpio_rise_ip_blue     GPIO_PIN_BLUE
+#define FIELD_gpio_rise_ip_all      GPIO_PIN_ALL
+#define FIELD_gpio_fall_ip_red      GPIO_PIN_RED
+#define FIELD_gpio_fall_ip_green    GPIO_PIN_GREEN
+#define FIELD_gpio_fall_ip_blue     GPIO_PIN_BLUE
+#define FIELD_gpio_fall_ip_all      GPIO_PIN_ALL
+#define FIELD_gpio_high_ip_all      GPIO_PIN_ALL
+#define FIELD_gpio_low_ip_all       GPIO_PIN_ALL
+
+// ---- SiFive UART0 ------------------------------------------------------------
+
+#define REGDEF_sifive_uart_txdata   (SIFIVE_UART0_BASE + 0x00), uint32_t, REG_PUSH, 0
+#define FIELD_sifive_uart_txdata_data   0, 8, REG_W
+#define FIELD_sifive_uart_txdata_full   31, 1, REG_R     // TX FIFO full
+
+#define REGDEF_sifive_uart_rxdata   (SIFIVE_UART0_BASE + 0x04), uint32_t, REG_R, 0x80000000u
+#define FIELD_sifive_uart_rxdata_data   0, 8, REG_R
+#define FIELD_sifive_uart_rxdata_empty  31, 1, REG_R     // RX FIFO empty (read pops)
+
+#define REGDEF_sifive_uart_txctrl   (SIFIVE_UART0_BASE + 0x08), uint32_t, REG_RW, 0
+#define FIELD_sifive_uart_txctrl_txen   0, 1, REG_RW
+#define FIELD_sifive_uart_txctrl_nstop  1, 1, REG_RW     // 0: one stop bit
+#define FIELD_sifive_uart_txctrl_txcnt  16, 3, REG_RW    // TX watermark
+
+#define REGDEF_sifive_uart_rxctrl   (SIFIVE_UART0_BASE + 0x0C), uint32_t, REG_RW, 0
+#define FIELD_sifive_uart_rxctrl_rxen   0, 1, REG_RW
+#define FIELD_sifive_uart_rxctrl_rxcnt  16, 3, REG_RW    // RX watermark
+
+#define REGDEF_sifive_uart_ie       (SIFIVE_UART0_BASE + 0x10), uint32_t, REG_RW, 0
+#define FIELD_sifive_uart_ie_txwm       0, 1, REG_RW
+#define FIELD_sifive_uart_ie_rxwm       1, 1, REG_RW
+
+#define REGDEF_sifive_uart_ip       (SIFIVE_UART0_BASE + 0x14), uint32_t, REG_R, 0
+#define FIELD_sifive_uart_ip_txwm       0, 1, REG_R
+#define FIELD_sifive_uart_ip_rxwm       1, 1, REG_R
+
+// ---- 16550 UART (byte registers) ---------------------------------------------
+
+#define REGDEF_ns16550_rbr  (NS16550_BASE + 0x00), uint8_t, REG_R, 0
+#define FIELD_ns16550_rbr_data      0, 8, REG_R
+
+#define REGDEF_ns16550_thr  (NS16550_BASE + 0x00), uint8_t, REG_W, 0
+#define FIELD_ns16550_thr_data      0, 8, REG_W
+
+#define REGDEF_ns16550_ier  (NS16550_BASE + 0x01), uint8_t, REG_RW, 0
+#define FIELD_ns16550_ier_rx        0, 1, REG_RW    // Received data available
+#define FIELD_ns16550_ier_thre      1, 1, REG_RW    // Transmitter empty
+#define FIELD_ns16550_ier_lsr       2, 1, REG_RW    // Line status
+
+#define REGDEF_ns16550_fcr  (NS16550_BASE + 0x02), uint8_t, REG_W, 0
+#define FIELD_ns16550_fcr_enable    0, 1, REG_W
+#define FIELD_ns16550_fcr_rx_reset  1, 1, REG_W
+#define FIELD_ns16550_fcr_tx_reset  2, 1, REG_W
+#define FIELD_ns16550_fcr_trigger   6, 2, REG_W     // 0: 1 byte .. 3: 14 bytes
+
+#define REGDEF_ns16550_mcr  (NS16550_BASE + 0x04), uint8_t, REG_RW, 0
+#define FIELD_ns16550_mcr_dtr       0, 1, REG_RW
+#define FIELD_ns16550_mcr_rts       1, 1, REG_RW
+#define FIELD_ns16550_mcr_out2      3, 1, REG_RW    // IRQ line on PC-style boards
+#define FIELD_ns16550_mcr_loop      4, 1, REG_RW
+
+#define REGDEF_ns16550_lsr  (NS16550_BASE + 0x05), uint8_t, REG_R, 0x60
+#define FIELD_ns16550_lsr_dr        0, 1, REG_R     // Data ready
+#define FIELD_ns16550_lsr_thre      5, 1, REG_R     // THR empty
+#define FIELD_ns16550_lsr_temt      6, 1, REG_R     // Transmitter idle
+
+// ---- CLINT (hart 0; hart n is 4 bytes / 8 bytes further) ---------------------
+
+#define REGDEF_clint_msip0          (CLINT_BASE + 0x0000), uint32_t, REG_RW, 0
+#define FIELD_clint_msip0_msip          0, 1, REG_RW
+
+#define REGDEF_clint_mtimecmp0_lo   (CLINT_BASE + 0x4000), uint32_t, REG_RW, 0xFFFFFFFFu
+#define REGDEF_clint_mtimecmp0_hi   (CLINT_BASE + 0x4004), uint32_t, REG_RW, 0xFFFFFFFFu
+#define FIELD_clint_mtimecmp0_lo_val    0, 32, REG_RW
+#define FIELD_clint_mtimecmp0_hi_val    0, 32, REG_RW
+
+#define REGDEF_clint_mtime_lo       (CLINT_BASE + 0xBFF8), uint32_t, REG_RW, 0
+#define REGDEF_clint_mtime_hi       (CLINT_BASE + 0xBFFC), uint32_t, REG_RW, 0
+#define FIELD_clint_mtime_lo_val        0, 32, REG_RW
+#define FIELD_clint_mtime_hi_val        0, 32, REG_RW
+
+#endif /* REGMAP_H */
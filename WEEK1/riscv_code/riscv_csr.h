@@ -0,0 +1,79 @@
+#ifndef RISCV_CSR_H
+#define RISCV_CSR_H
+
+#include <stdint.h>
+
+// mstatus fields (RV32 machine mode)
+#define MSTATUS_MIE         (1u << 3)   // Machine interrupt enable
+#define MSTATUS_MPIE        (1u << 7)   // Previous MIE (restored by mret)
+#define MSTATUS_MPP         (3u << 11)  // Previous privilege mode
+#define MSTATUS_FS          (3u << 13)  // Floating-point unit state
+#define MSTATUS_FS_OFF      (0u << 13)  // FP instructions trap as illegal
+#define MSTATUS_FS_INITIAL  (1u << 13)  // FP registers hold reset values
+#define MSTATUS_FS_CLEAN    (2u << 13)  // FP registers match saved copy
+#define MSTATUS_FS_DIRTY    (3u << 13)  // FP registers modified since save
+#define MSTATUS_SD          (1u << 31)  // Summary dirty (FS or XS dirty)
+
+// mie / mip bits
+#define MIP_MSIP            (1u << 3)   // Machine software interrupt
+#define MIP_MTIP            (1u << 7)   // Machine timer interrupt
+#define MIP_MEIP            (1u << 11)  // Machine external interrupt
+
+// sstatus / sie / sip bits (supervisor mode)
+#define SSTATUS_SIE         (1u << 1)   // Supervisor interrupt enable
+#define SSTATUS_SPIE        (1u << 5)   // Previous SIE (restored by sret)
+#define SIP_SSIP            (1u << 1)   // Supervisor software interrupt
+#define SIP_STIP            (1u << 5)   // Supervisor timer interrupt
+#define SIP_SEIP            (1u << 9)   // Supervisor external interrupt
+
+// mcause / scause values
+#define MCAUSE_INTERRUPT    (1u << 31)
+#define MCAUSE_CODE(c)      ((c) & 0x7FFFFFFFu)
+#define IRQ_M_SOFT          3
+#define IRQ_M_TIMER         7
+#define IRQ_M_EXT           11
+#define IRQ_S_SOFT          1
+#define IRQ_S_TIMER         5
+#define IRQ_S_EXT           9
+#define EXC_ILLEGAL_INSN    2
+#define EXC_ECALL_S         9
+#define EXC_ECALL_M         11
+
+// Generic CSR accessors. The register is a CSR name or number; it is
+// macro-expanded first, so a #define'd CSR number works as well.
+#define CSR_STR(x) #x
+#define CSR_XSTR(x) CSR_STR(x)
+
+#define read_csr(reg) ({                                        \
+    uint32_t __v;                                               \
+    asm volatile ("csrr %0, " CSR_XSTR(reg) : "=r"(__v));       \
+    __v; })
+
+#define write_csr(reg, val) \
+    asm volatile ("csrw " CSR_XSTR(reg) ", %0" : : "rK"(val) : "memory")
+
+#define set_csr(reg, bits) \
+    asm volatile ("csrs " CSR_XSTR(reg) ", %0" : : "rK"(bits) : "memory")
+
+#define clear_csr(reg, bits) \
+    asm volatile ("csrc " CSR_XSTR(reg) ", %0" : : "rK"(bits) : "memory")
+
+// Cycle counter (low 32 bits are enough for short measurements)
+static inline uint32_t rdcycle(void) {
+    uint32_t c;
+    asm volatile ("rdcycle %0" : "=r"(c));
+    return c;
+}
+
+// Full 64-bit cycle counter, re-reading cycleh if the low word wrapped
+static inline uint64_t rdcycle64(void) {
+    uint32_t hi, lo, hi2;
+    do {
+        asm volatile ("rdcycleh %0" : "=r"(hi));
+        asm volatile ("rdcycle %0" : "=r"(lo));
+        asm volatile ("rdcycleh %0" : "=r"(hi2));
+    } while (hi != hi2);
+    return ((uint64_t)hi << 32) | lo;
+}
+
+#endif /* RISCV_CSR_H */
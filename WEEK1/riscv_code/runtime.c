@@ -0,0 +1,202 @@
+#include <stdint.h>
+#include "runtime.h"
+#include "riscv_csr.h"
+#ifdef RUNTIME_SMODE
+#include "sbi.h"
+#endif
+
+#define REG32(addr) (*(volatile uint32_t *)(addr))
+#define REG8(addr)  (*(volatile uint8_t *)(addr))
+
+// Sstc stimecmp/stimecmph (numeric: older assemblers lack the names)
+#define CSR_STIMECMP    0x14D
+#define CSR_STIMECMPH   0x15D
+
+static uint32_t boot_hartid = 0;
+static int sstc_available = 0;
+
+// Illegal-instruction probe support (see probe_stimecmp)
+static volatile int probe_active = 0;
+static volatile int probe_faulted = 0;
+
+// Fatal trap information (inspect with GDB)
+volatile uint32_t fatal_cause = 0;
+volatile uint32_t fatal_epc = 0;
+volatile uint32_t fatal_tval = 0;
+
+#ifdef RUNTIME_SMODE
+
+// Reading stimecmp traps unless the hart has Sstc and M-mode set
+// menvcfg.STCE; the trap handler skips the csrr and flags the fault.
+static int probe_stimecmp(void) {
+    probe_faulted = 0;
+    probe_active = 1;
+    (void)read_csr(CSR_STIMECMP);
+    probe_active = 0;
+    return !probe_faulted;
+}
+
+// Saved by sbi_start.s: OpenSBI passes a0 = hartid, a1 = FDT address
+extern uint32_t sbi_boot_hartid;
+
+void rt_init(void) {
+    boot_hartid = sbi_boot_hartid;
+    sbi_init();
+    sstc_available = probe_stimecmp();
+}
+
+const char *rt_mode_name(void) {
+    return "S-mode (OpenSBI)";
+}
+
+uint64_t rt_time(void) {
+    uint32_t hi, lo, hi2;
+    do {
+        asm volatile ("rdtimeh %0" : "=r"(hi));
+        asm volatile ("rdtime %0" : "=r"(lo));
+        asm volatile ("rdtimeh %0" : "=r"(hi2));
+    } while (hi != hi2);
+    return ((uint64_t)hi << 32) | lo;
+}
+
+void rt_set_timer(uint64_t when) {
+    if (sstc_available) {
+        // Low word to all-ones first so no intermediate value is in the past
+        write_csr(CSR_STIMECMP, 0xFFFFFFFFu);
+        write_csr(CSR_STIMECMPH, (uint32_t)(when >> 32));
+        write_csr(CSR_STIMECMP, (uint32_t)when);
+    } else {
+        sbi_set_timer(when);
+    }
+}
+
+void rt_send_ipi(uint32_t hart) {
+    sbi_send_ipi(1, hart);
+}
+
+void rt_console_putc(char c) {
+    sbi_console_putchar(c);
+}
+
+void rt_console_write(const char *buf, int len) {
+    sbi_console_write(buf, len);
+}
+
+void rt_enable_irq(uint32_t irq) {
+    static const uint32_t bits[] = { SIP_SSIP, SIP_STIP, SIP_SEIP };
+    set_csr(sie, bits[irq]);
+    set_csr(sstatus, SSTATUS_SIE);
+}
+
+void rt_exit(int code) {
+    sbi_shutdown(code != 0);
+}
+
+#define TRAP_IRQ_SOFT   IRQ_S_SOFT
+#define TRAP_IRQ_TIMER  IRQ_S_TIMER
+#define TRAP_IRQ_EXT    IRQ_S_EXT
+#define write_epc(v)    write_csr(sepc, (v))
+#define clear_soft_irq() clear_csr(sip, SIP_SSIP)
+
+#else /* M-mode */
+
+void rt_init(void) {
+    boot_hartid = read_csr(mhartid);
+    sstc_available = 0;
+}
+
+const char *rt_mode_name(void) {
+    return "M-mode (direct MMIO)";
+}
+
+uint64_t rt_time(void) {
+    uint32_t hi, lo, hi2;
+    do {
+        hi = REG32(RT_CLINT_MTIME + 4);
+        lo = REG32(RT_CLINT_MTIME);
+        hi2 = REG32(RT_CLINT_MTIME + 4);
+    } while (hi != hi2);
+    return ((uint64_t)hi << 32) | lo;
+}
+
+void rt_set_timer(uint64_t when) {
+    uint32_t cmp = RT_CLINT_MTIMECMP(boot_hartid);
+    REG32(cmp) = 0xFFFFFFFFu;
+    REG32(cmp + 4) = (uint32_t)(when >> 32);
+    REG32(cmp) = (uint32_t)when;
+}
+
+void rt_send_ipi(uint32_t hart) {
+    REG32(RT_CLINT_MSIP(hart)) = 1;
+}
+
+void rt_console_putc(char c) {
+    REG8(RT_UART_THR) = (uint8_t)c;
+}
+
+void rt_console_write(const char *buf, int len) {
+    for (int i = 0; i < len; i++) {
+        REG8(RT_UART_THR) = (uint8_t)buf[i];
+    }
+}
+
+void rt_enable_irq(uint32_t irq) {
+    static const uint32_t bits[] = { MIP_MSIP, MIP_MTIP, MIP_MEIP };
+    set_csr(mie, bits[irq]);
+    set_csr(mstatus, MSTATUS_MIE);
+}
+
+void rt_exit(int code) {
+    REG32(RT_TEST_FINISHER) = code ? (((uint32_t)code << 16) | 0x3333) : 0x5555;
+    while (1) {
+        asm volatile ("wfi");
+    }
+}
+
+#define TRAP_IRQ_SOFT   IRQ_M_SOFT
+#define TRAP_IRQ_TIMER  IRQ_M_TIMER
+#define TRAP_IRQ_EXT    IRQ_M_EXT
+#define write_epc(v)    write_csr(mepc, (v))
+#define clear_soft_irq() (REG32(RT_CLINT_MSIP(boot_hartid)) = 0)
+
+#endif /* RUNTIME_SMODE */
+
+uint32_t rt_hartid(void) {
+    return boot_hartid;
+}
+
+int rt_has_sstc(void) {
+    return sstc_available;
+}
+
+// Called from trap_entry (trap_start.s, M-mode) or strap_entry
+// (sbi_start.s, S-mode) with the matching cause/epc/tval CSRs
+void trap_dispatch(uint32_t cause, uint32_t epc, uint32_t tval) {
+    if (cause & MCAUSE_INTERRUPT) {
+        switch (MCAUSE_CODE(cause)) {
+        case TRAP_IRQ_SOFT:
+            clear_soft_irq();
+            rt_irq_handler(RT_IRQ_SOFT);
+            break;
+        case TRAP_IRQ_TIMER:
+            rt_set_timer(UINT64_MAX);   // Level-triggered: quiet it first
+            rt_irq_handler(RT_IRQ_TIMER);
+            break;
+        case TRAP_IRQ_EXT:
+            rt_irq_handler(RT_IRQ_EXT);
+            break;
+        }
+        return;
+    }
+
+    if (probe_active && cause == EXC_ILLEGAL_INSN) {
+        probe_faulted = 1;
+        write_epc(epc + 4);     // Skip the 4-byte csrr being probed
+        return;
+    }
+
+    fatal_cause = cause;
+    fatal_epc = epc;
+    fatal_tval = tval;
+    rt_exit(1);
+}
@@ -0,0 +1,50 @@
+#ifndef RUNTIME_H
+#define RUNTIME_H
+
+#include <stdint.h>
+#include "regmap.h"
+
+// Minimal platform runtime with two build variants:
+//   default          M-mode, direct MMIO to CLINT and UART (-bios none)
+//   -DRUNTIME_SMODE  S-mode payload under OpenSBI, SBI TIME/IPI/DBCN calls
+//                    and the Sstc stimecmp CSR when the hart has it
+
+// Interrupt classes passed to rt_irq_handler()
+#define RT_IRQ_SOFT     0
+#define RT_IRQ_TIMER    1
+#define RT_IRQ_EXT      2
+
+// QEMU virt devices (addresses from regmap.h)
+#define RT_CLINT_MSIP(h)    (REG_ADDR(clint_msip0) + 4 * (h))
+#define RT_CLINT_MTIMECMP(h) (REG_ADDR(clint_mtimecmp0_lo) + 8 * (h))
+#define RT_CLINT_MTIME      REG_ADDR(clint_mtime_lo)
+#define RT_UART_THR         REG_ADDR(ns16550_thr)
+#define RT_TEST_FINISHER    0x00100000  // sifive_test: 0x5555 = pass
+
+void rt_init(void);
+const char *rt_mode_name(void);
+uint32_t rt_hartid(void);
+int rt_has_sstc(void);
+
+// Timer (ticks of the platform timebase, 10 MHz on QEMU virt)
+uint64_t rt_time(void);
+void rt_set_timer(uint64_t when);
+
+// Inter-hart (or self) software interrupt
+void rt_send_ipi(uint32_t hart);
+
+// Raw console output (no CRLF conversion)
+void rt_console_putc(char c);
+void rt_console_write(const char *buf, int len);
+
+// Enable one interrupt class and global interrupts for this hart
+void rt_enable_irq(uint32_t irq);
+
+// Power off QEMU with a status (M-mode: test finisher, S-mode: SBI SRST)
+void rt_exit(int code);
+
+// Provided by the application. Timer: the runtime has already pushed the
+// compare value to "never", re-arm with rt_set_timer() for periodic use.
+void rt_irq_handler(uint32_t irq);
+
+#endif /* RUNTIME_H */
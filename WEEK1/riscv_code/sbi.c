@@ -0,0 +1,108 @@
+#include <stdint.h>
+#include "sbi.h"
+
+// Probed once, on first use
+static int sbi_probed = 0;
+static uint32_t spec_version = 0;
+static int dbcn_available = 0;
+
+void sbi_init(void) {
+    struct sbiret ret;
+
+    ret = sbi_ecall(SBI_EXT_BASE, SBI_BASE_GET_SPEC_VERSION, 0, 0, 0);
+    spec_version = (ret.error == SBI_SUCCESS) ? (uint32_t)ret.value : 0;
+
+    // Debug console is an SBI 2.0 extension; older firmware only has
+    // the legacy one-byte putchar
+    ret = sbi_ecall(SBI_EXT_BASE, SBI_BASE_PROBE_EXT, SBI_EXT_DBCN, 0, 0);
+    dbcn_available = (ret.error == SBI_SUCCESS && ret.value != 0);
+
+    sbi_probed = 1;
+}
+
+uint32_t sbi_spec_version(void) {
+    if (!sbi_probed) {
+        sbi_init();
+    }
+    return spec_version;
+}
+
+int sbi_has_dbcn(void) {
+    if (!sbi_probed) {
+        sbi_init();
+    }
+    return dbcn_available;
+}
+
+void sbi_set_timer(uint64_t stime_value) {
+    // RV32: 64-bit argument is split across a0 (low) and a1 (high)
+    sbi_ecall(SBI_EXT_TIME, SBI_TIME_SET_TIMER,
+              (uint32_t)stime_value, (uint32_t)(stime_value >> 32), 0);
+}
+
+void sbi_send_ipi(uint32_t hart_mask, uint32_t hart_mask_base) {
+    sbi_ecall(SBI_EXT_IPI, SBI_IPI_SEND_IPI, hart_mask, hart_mask_base, 0);
+}
+
+void sbi_console_putchar(char c) {
+    if (sbi_has_dbcn()) {
+        sbi_ecall(SBI_EXT_DBCN, SBI_DBCN_CONSOLE_WRITE_BYTE, (uint8_t)c, 0, 0);
+    } else {
+        sbi_ecall(SBI_EXT_LEGACY_PUTCHAR, 0, (uint8_t)c, 0, 0);
+    }
+}
+
+void sbi_console_write(const char *buf, int len) {
+    if (!sbi_has_dbcn()) {
+        for (int i = 0; i < len; i++) {
+            sbi_console_putchar(buf[i]);
+        }
+        return;
+    }
+
+    // One ecall for the whole buffer (physical address = virtual, satp off).
+    // The firmware may write fewer bytes than asked for.
+    while (len > 0) {
+        struct sbiret ret = sbi_ecall(SBI_EXT_DBCN, SBI_DBCN_CONSOLE_WRITE,
+                                      (uint32_t)len, (uint32_t)buf, 0);
+        if (ret.error != SBI_SUCCESS || ret.value <= 0) {
+            break;
+        }
+        buf += ret.value;
+        len -= (int)ret.value;
+    }
+}
+
+int sbi_console_read(char *buf, int len) {
+    int n = 0;
+
+    if (!sbi_has_dbcn()) {
+        // Legacy getchar returns the byte in a0, or -1 when none is waiting
+        while (n < len) {
+            struct sbiret ret = sbi_ecall(SBI_EXT_LEGACY_GETCHAR, 0, 0, 0, 0);
+            if (ret.error < 0) {
+                break;
+            }
+            buf[n++] = (char)ret.error;
+        }
+        return n;
+    }
+
+    if (len > 0) {
+        struct sbiret ret = sbi_ecall(SBI_EXT_DBCN, SBI_DBCN_CONSOLE_READ,
+                                      (uint32_t)len, (uint32_t)buf, 0);
+        if (ret.error != SBI_SUCCESS) {
+            return -1;
+        }
+        n = (int)ret.value;
+    }
+    return n;
+}
+
+void sbi_shutdown(int failure) {
+    sbi_ecall(SBI_EXT_SRST, SBI_SRST_SYSTEM_RESET, SBI_SRST_SHUTDOWN,
+              failure ? SBI_SRST_REASON_FAILURE : SBI_SRST_REASON_NONE, 0);
+    while (1) {
+        asm volatile ("wfi");
+    }
+}
@@ -0,0 +1,75 @@
+#ifndef SBI_H
+#define SBI_H
+
+#include <stdint.h>
+
+// RISC-V Supervisor Binary Interface (calls into OpenSBI from S-mode)
+// Calling convention: a7 = extension ID, a6 = function ID, a0-a5 = args,
+// returns error in a0 and value in a1.
+
+// Extension IDs
+#define SBI_EXT_LEGACY_PUTCHAR  0x01
+#define SBI_EXT_LEGACY_GETCHAR  0x02
+#define SBI_EXT_BASE            0x10
+#define SBI_EXT_TIME            0x54494D45  // "TIME"
+#define SBI_EXT_IPI             0x00735049  // "sPI"
+#define SBI_EXT_SRST            0x53525354  // "SRST"
+#define SBI_EXT_DBCN            0x4442434E  // "DBCN"
+
+// Function IDs
+#define SBI_BASE_GET_SPEC_VERSION   0
+#define SBI_BASE_GET_IMPL_ID        1
+#define SBI_BASE_PROBE_EXT          3
+#define SBI_TIME_SET_TIMER          0
+#define SBI_IPI_SEND_IPI            0
+#define SBI_SRST_SYSTEM_RESET       0
+#define SBI_DBCN_CONSOLE_WRITE      0
+#define SBI_DBCN_CONSOLE_READ       1
+#define SBI_DBCN_CONSOLE_WRITE_BYTE 2
+
+// System reset types / reasons
+#define SBI_SRST_SHUTDOWN           0
+#define SBI_SRST_REASON_NONE        0
+#define SBI_SRST_REASON_FAILURE     1
+
+// Error codes
+#define SBI_SUCCESS                 0
+#define SBI_ERR_NOT_SUPPORTED       (-2)
+
+struct sbiret {
+    long error;
+    long value;
+};
+
+static inline struct sbiret sbi_ecall(uint32_t ext, uint32_t fid,
+                                      uint32_t arg0, uint32_t arg1,
+                                      uint32_t arg2) {
+    register uint32_t a0 asm("a0") = arg0;
+    register uint32_t a1 asm("a1") = arg1;
+    register uint32_t a2 asm("a2") = arg2;
+    register uint32_t a6 asm("a6") = fid;
+    register uint32_t a7 asm("a7") = ext;
+    struct sbiret ret;
+
+    asm volatile ("ecall"
+                  : "+r"(a0), "+r"(a1)
+                  : "r"(a2), "r"(a6), "r"(a7)
+                  : "memory");
+
+    ret.error = (long)a0;
+    ret.value = (long)a1;
+    return ret;
+}
+
+// sbi.c
+void sbi_init(void);
+uint32_t sbi_spec_version(void);
+int sbi_has_dbcn(void);
+void sbi_set_timer(uint64_t stime_value);
+void sbi_send_ipi(uint32_t hart_mask, uint32_t hart_mask_base);
+void sbi_console_write(const char *buf, int len);
+void sbi_console_putchar(char c);
+int sbi_console_read(char *buf, int len);    // Non-blocking, -1 on error
+void sbi_shutdown(int failure);
+
+#endif /* SBI_H */
@@ -0,0 +1,101 @@
+# Startup for an S-mode payload under OpenSBI (fw_dynamic).
+# OpenSBI enters here in S-mode with a0 = hartid, a1 = FDT address.
+.section .text.start
+.global _start
+
+_start:
+    # Keep the boot arguments across BSS clearing
+    mv s0, a0
+    mv s1, a1
+
+    # Set up stack pointer
+    lui sp, %hi(_stack_top)
+    addi sp, sp, %lo(_stack_top)
+
+    # Initialize BSS section
+    la t0, _bss_start
+    la t1, _bss_end
+bss_loop:
+    bge t0, t1, bss_done
+    sw zero, 0(t0)
+    addi t0, t0, 4
+    j bss_loop
+bss_done:
+
+    la t0, sbi_boot_hartid
+    sw s0, 0(t0)
+    la t0, sbi_boot_fdt
+    sw s1, 0(t0)
+
+    # Initialize supervisor trap vector (direct mode)
+    la t0, strap_entry
+    csrw stvec, t0
+
+    # Call main program
+    call main
+
+    # Power off through SBI SRST with main's return value
+    call sbi_shutdown
+1:  j 1b
+
+.size _start, . - _start
+
+# Supervisor trap entry: same frame as trap_entry in trap_start.s, using
+# the S-mode CSRs, calls
+#     void trap_dispatch(uint32_t scause, uint32_t sepc, uint32_t stval)
+.section .text
+.balign 4
+.global strap_entry
+strap_entry:
+    addi sp, sp, -64
+    sw ra,  0(sp)
+    sw t0,  4(sp)
+    sw t1,  8(sp)
+    sw t2, 12(sp)
+    sw a0, 16(sp)
+    sw a1, 20(sp)
+    sw a2, 24(sp)
+    sw a3, 28(sp)
+    sw a4, 32(sp)
+    sw a5, 36(sp)
+    sw a6, 40(sp)
+    sw a7, 44(sp)
+    sw t3, 48(sp)
+    sw t4, 52(sp)
+    sw t5, 56(sp)
+    sw t6, 60(sp)
+
+    csrr a0, scause
+    csrr a1, sepc
+    csrr a2, stval
+    call trap_dispatch
+
+    lw ra,  0(sp)
+    lw t0,  4(sp)
+    lw t1,  8(sp)
+    lw t2, 12(sp)
+    lw a0, 16(sp)
+    lw a1, 20(sp)
+    lw a2, 24(sp)
+    lw a3, 28(sp)
+    lw a4, 32(sp)
+    lw a5, 36(sp)
+    lw a6, 40(sp)
+    lw a7, 44(sp)
+    lw t3, 48(sp)
+    lw t4, 52(sp)
+    lw t5, 56(sp)
+    lw t6, 60(sp)
+    addi sp, sp, 64
+
+    # Return from trap
+    sret
+
+.size strap_entry, . - strap_entry
+
+.section .bss
+.balign 4
+.global sbi_boot_hartid
+sbi_boot_hartid: .word 0
+.global sbi_boot_fdt
+sbi_boot_fdt:    .word 0
@@ -0,0 +1,77 @@
+#include <stdint.h>
+#include "semihost.h"
+
+// The debugger (or QEMU) recognises a semihosting request by the exact
+// uncompressed sequence slli/ebreak/srai, which must not straddle a page.
+// The 16-byte alignment keeps all three words in one page.
+__attribute__((noinline))
+int32_t sh_call(uint32_t op, const void *args) {
+    register uint32_t a0 asm("a0") = op;
+    register const void *a1 asm("a1") = args;
+
+    asm volatile (".balign 16\n"
+                  ".option push\n"
+                  ".option norvc\n"
+                  "slli zero, zero, 0x1f\n"
+                  "ebreak\n"
+                  "srai zero, zero, 7\n"
+                  ".option pop\n"
+                  : "+r"(a0)
+                  : "r"(a1)
+                  : "memory");
+    return (int32_t)a0;
+}
+
+// Returns a host handle or -1
+int sh_open(const char *name, uint32_t mode) {
+    uint32_t len = 0;
+    while (name[len]) {
+        len++;
+    }
+
+    uint32_t args[3] = { (uint32_t)name, mode, len };
+    return sh_call(SYS_OPEN, args);
+}
+
+int sh_close(int handle) {
+    uint32_t args[1] = { (uint32_t)handle };
+    return sh_call(SYS_CLOSE, args);
+}
+
+// SYS_WRITE returns the number of bytes NOT written; convert to written
+int sh_write(int handle, const void *buf, uint32_t len) {
+    uint32_t args[3] = { (uint32_t)handle, (uint32_t)buf, len };
+    int32_t left = sh_call(SYS_WRITE, args);
+    return (left < 0) ? -1 : (int)(len - (uint32_t)left);
+}
+
+// SYS_READ returns the number of bytes NOT read; convert to read
+int sh_read(int handle, void *buf, uint32_t len) {
+    uint32_t args[3] = { (uint32_t)handle, (uint32_t)buf, len };
+    int32_t left = sh_call(SYS_READ, args);
+    return (left < 0) ? -1 : (int)(len - (uint32_t)left);
+}
+
+void sh_write0(const char *str) {
+    sh_call(SYS_WRITE0, str);
+}
+
+uint32_t sh_clock(void) {
+    return (uint32_t)sh_call(SYS_CLOCK, 0);
+}
+
+int sh_errno(void) {
+    return sh_call(SYS_ERRNO, 0);
+}
+
+// On RV32 plain SYS_EXIT only carries the reason (exit status 0 or 1),
+// so use SYS_EXIT_EXTENDED to pass the actual code to the host
+void sh_exit(int code) {
+    uint32_t args[2] = { ADP_STOPPED_APPLICATION_EXIT, (uint32_t)code };
+    sh_call(SYS_EXIT_EXTENDED, args);
+
+    // Host ignored the request: park the hart
+    while (1) {
+        asm volatile ("wfi");
+    }
+}
@@ -0,0 +1,52 @@
+#ifndef SEMIHOST_H
+#define SEMIHOST_H
+
+#include <stdint.h>
+
+// RISC-V semihosting (ARM semihosting operations, RISC-V trap sequence).
+// Enable in QEMU with:
+//   -semihosting-config enable=on,target=native
+// Without a debugger or QEMU listening, the ebreak traps like any other.
+
+// Operation numbers (a0)
+#define SYS_OPEN            0x01
+#define SYS_CLOSE           0x02
+#define SYS_WRITEC          0x03
+#define SYS_WRITE0          0x04
+#define SYS_WRITE           0x05
+#define SYS_READ            0x06
+#define SYS_CLOCK           0x10
+#define SYS_TIME            0x11
+#define SYS_ERRNO           0x13
+#define SYS_EXIT            0x18
+#define SYS_EXIT_EXTENDED   0x20
+
+// SYS_OPEN modes (fopen() strings "r", "rb", "r+", ... in order)
+#define SH_MODE_R           0
+#define SH_MODE_RB          1
+#define SH_MODE_RB_PLUS     3
+#define SH_MODE_W           4
+#define SH_MODE_WB          5
+#define SH_MODE_WB_PLUS     7
+#define SH_MODE_A           8
+#define SH_MODE_AB          9
+#define SH_MODE_AB_PLUS     11
+
+// The special file name ":tt" opens the host console
+#define SH_CONSOLE_NAME     ":tt"
+
+// SYS_EXIT reason code for a normal application exit
+#define ADP_STOPPED_APPLICATION_EXIT 0x20026
+
+// semihost.c
+int32_t sh_call(uint32_t op, const void *args);
+int sh_open(const char *name, uint32_t mode);
+int sh_close(int handle);
+int sh_write(int handle, const void *buf, uint32_t len);
+int sh_read(int handle, void *buf, uint32_t len);
+void sh_write0(const char *str);
+uint32_t sh_clock(void);     // Centiseconds since the program started
+int sh_errno(void);
+void sh_exit(int code) __attribute__((noreturn));
+
+#endif /* SEMIHOST_H */
@@ -0,0 +1,87 @@
+#ifndef SIFIVE_UART_H
+#define SIFIVE_UART_H
+
+#include <stdint.h>
+#include "regmap.h"
+
+// SiFive UART0 (FE310 / QEMU sifive_e). Not a 16550: 32-bit registers,
+// FIFO status in bit 31 of the data registers. Layout in regmap.h.
+#define SIFIVE_UART_TXDATA  REG_ADDR(sifive_uart_txdata)  // bit 31: TX FIFO full
+#define SIFIVE_UART_RXDATA  REG_ADDR(sifive_uart_rxdata)  // bit 31: RX FIFO empty
+#define SIFIVE_UART_TXCTRL  REG_ADDR(sifive_uart_txctrl)
+#define SIFIVE_UART_RXCTRL  REG_ADDR(sifive_uart_rxctrl)
+#define SIFIVE_UART_IE      REG_ADDR(sifive_uart_ie)
+#define SIFIVE_UART_IP      REG_ADDR(sifive_uart_ip)
+
+#define SIFIVE_UART_FIFO_FLAG   (1u << 31)
+#define SIFIVE_UART_TXEN        (1u << 0)
+#define SIFIVE_UART_RXEN        (1u << 0)
+#define SIFIVE_UART_IE_RXWM     (1u << 1)   // RX count > watermark (rxcnt)
+
+#define SIFIVE_UART0_IRQ    3               // PLIC source on sifive_e
+
+#define SIFIVE_UART_REG(addr)   (*(volatile uint32_t *)(addr))
+
+static inline void sifive_uart_init(void) {
+    reg_write(sifive_uart_txctrl, (txen, 1));
+    reg_write(sifive_uart_rxctrl, (rxen, 1), (rxcnt, 0));
+}
+
+static inline void sifive_uart_putc(char c) {
+    while (reg_get(sifive_uart_txdata, full)) {
+    }
+    reg_write(sifive_uart_txdata, (data, c));
+}
+
+// Returns the byte, or -1 if the RX FIFO is empty (reading pops it)
+static inline int sifive_uart_getc(void) {
+    uint32_t v = reg_read(sifive_uart_rxdata);
+    return reg_field(sifive_uart_rxdata, empty, v) ? -1 :
+           (int)reg_field(sifive_uart_rxdata, data, v);
+}
+
+// Console output for the sifive_e demos ('\n' becomes "\r\n")
+static inline void put_str(const char *s) {
+    while (*s) {
+        if (*s == '\n') {
+            sifive_uart_putc('\r');
+        }
+        sifive_uart_putc(*s++);
+    }
+}
+
+// Decimal, right-aligned in `width` columns (0: no padding)
+static inline void put_dec(uint32_t v, int width) {
+    char buf[11];
+    int i = 0;
+    do {
+        buf[i++] = (char)('0' + v % 10);
+        v /= 10;
+    } while (v);
+    while (width-- > i) {
+        sifive_uart_putc(' ');
+    }
+    while (i) {
+        sifive_uart_putc(buf[--i]);
+    }
+}
+
+// String, left-aligned in `width` columns
+static inline void put_pad(const char *s, int width) {
+    put_str(s);
+    for (int n = 0; s[n]; n++) {
+        width--;
+    }
+    while (width-- > 0) {
+        sifive_uart_putc(' ');
+    }
+}
+
+static inline void put_hex(uint32_t v) {
+    put_str("0x");
+    for (int shift = 28; shift >= 0; shift -= 4) {
+        sifive_uart_putc("0123456789abcdef"[(v >> shift) & 0xF]);
+    }
+}
+
+#endif /* SIFIVE_UART_H */
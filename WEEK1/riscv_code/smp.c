@@ -0,0 +1,93 @@
+#include <stdint.h>
+#include "smp.h"
+#include "riscv_csr.h"
+#include "clocksource.h"
+#include "stack.h"
+
+#define CHECKIN_QUIET_TICKS (TIMEBASE_HZ / 100)    // 10 ms without a new hart
+
+static volatile uint32_t online_mask = 1;   // Hart 0 is always online
+static volatile smp_entry_t secondary_entry = 0;
+
+static const char *const stack_names[SMP_MAX_HARTS] = {
+    "hart0", "hart1", "hart2", "hart3", "hart4", "hart5", "hart6", "hart7",
+};
+
+static inline void msip_write(uint32_t hart, uint32_t v) {
+    *(volatile uint32_t *)CLINT_MSIP_ADDR(hart) = v;
+}
+
+void smp_secondary_main(uint32_t hart) {
+    // Wake-ups only: MSIP pends and ends wfi, but never traps (MIE = 0)
+    clear_csr(mstatus, MSTATUS_MIE);
+    write_csr(mie, MIP_MSIP);
+    msip_write(hart, 0);
+
+    __atomic_fetch_or(&online_mask, 1u << hart, __ATOMIC_RELEASE);
+
+    for (;;) {
+        smp_entry_t entry = __atomic_load_n(&secondary_entry, __ATOMIC_ACQUIRE);
+        if (entry) {
+            entry(hart);
+        }
+        smp_sleep();
+    }
+}
+
+uint32_t smp_boot(void) {
+    uint32_t seen = __atomic_load_n(&online_mask, __ATOMIC_ACQUIRE);
+    uint64_t last_change = mtime_read();
+
+    while (mtime_read() - last_change < CHECKIN_QUIET_TICKS) {
+        uint32_t now = __atomic_load_n(&online_mask, __ATOMIC_ACQUIRE);
+        if (now != seen) {
+            seen = now;
+            last_change = mtime_read();
+        }
+    }
+
+    // Count the contiguous harts 0..n-1
+    uint32_t n = 0;
+    while (n < SMP_MAX_HARTS && (seen & (1u << n))) {
+        n++;
+    }
+
+    for (uint32_t h = 0; h < n; h++) {
+        stack_register(stack_names[h], smp_stack_lo(h), smp_stack_hi(h));
+    }
+    return n;
+}
+
+uint32_t *smp_stack_hi(uint32_t hart) {
+    return _stack_top - hart * (SMP_STACK_SIZE / sizeof(uint32_t));
+}
+
+uint32_t *smp_stack_lo(uint32_t hart) {
+    return smp_stack_hi(hart) - SMP_STACK_SIZE / sizeof(uint32_t);
+}
+
+uint32_t smp_online_mask(void) {
+    return __atomic_load_n(&online_mask, __ATOMIC_ACQUIRE);
+}
+
+void smp_start_secondaries(smp_entry_t entry) {
+    uint32_t mask = smp_online_mask();
+
+    __atomic_store_n(&secondary_entry, entry, __ATOMIC_RELEASE);
+    for (uint32_t h = 1; h < SMP_MAX_HARTS; h++) {
+        if (mask & (1u << h)) {
+            smp_wake(h);
+        }
+    }
+}
+
+void smp_wake(uint32_t hart) {
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    msip_write(hart, 1);
+}
+
+void smp_sleep(void) {
+    asm volatile ("wfi");
+    msip_write(smp_hart_id(), 0);
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+}
@@ -0,0 +1,45 @@
+#ifndef SMP_H
+#define SMP_H
+
+#include <stdint.h>
+
+// Multi-hart bring-up on QEMU virt (smp_start.s). Every hart enters at
+// _start; hart 0 runs main, the others check in and sleep in wfi until
+// smp_start_secondaries() hands them a function to run.
+
+#define SMP_MAX_HARTS       8           // Must match smp_start.s
+#define SMP_STACK_SIZE      (16 * 1024) // Per hart, must match smp_start.s
+
+typedef void (*smp_entry_t)(uint32_t hart);
+
+static inline uint32_t smp_hart_id(void) {
+    uint32_t id;
+    asm volatile ("csrr %0, mhartid" : "=r"(id));
+    return id;
+}
+
+// Hart 0: wait until the secondaries stop checking in, return the number
+// of harts online (including hart 0). Harts are numbered 0..n-1. The
+// stacks of the online harts (painted by smp_start.s) are registered with
+// stack_register() as "hart0".."hart7".
+uint32_t smp_boot(void);
+
+// Bounds of a hart's stack: [lo, hi), lo holds the canary
+uint32_t *smp_stack_lo(uint32_t hart);
+uint32_t *smp_stack_hi(uint32_t hart);
+
+uint32_t smp_online_mask(void);
+
+// Hart 0: make every online secondary call entry(hartid). It is called
+// once per hart and should not return.
+void smp_start_secondaries(smp_entry_t entry);
+
+// Software interrupt used as a wake-up: sleeping harts run with MIE off
+// and mie.MSIE on, so wfi returns when their MSIP is raised
+void smp_wake(uint32_t hart);
+void smp_sleep(void);               // wfi, then clear own MSIP
+
+// Called from smp_start.s on every secondary hart
+void smp_secondary_main(uint32_t hart) __attribute__((noreturn));
+
+#endif /* SMP_H */
@@ -0,0 +1,86 @@
+# Multi-hart entry for QEMU virt (-bios none starts every hart here).
+# Each hart gets its own stack below _stack_top and paints it for
+# stack_high_water(); hart 0 clears BSS and runs main, the others wait for
+# it and enter smp_secondary_main(hartid).
+
+.equ SMP_MAX_HARTS,     8
+.equ SMP_STACK_SHIFT,   14          # 16K per hart, see SMP_STACK_SIZE in smp.h
+.equ STACK_PAINT,       0xA5A5A5A5  # Must match stack.h
+.equ STACK_CANARY,      0x5AFEC0DE
+
+.section .text.start
+.global _start
+
+_start:
+    csrr a0, mhartid
+    li t0, SMP_MAX_HARTS
+    bgeu a0, t0, smp_park           # More harts than we have stacks for
+
+    # sp = _stack_top - hartid * SMP_STACK_SIZE
+    la sp, _stack_top
+    slli t0, a0, SMP_STACK_SHIFT
+    sub sp, sp, t0
+
+    # Paint this hart's stack (nothing lives on it yet), canary in the
+    # lowest word. Each hart paints only its own region.
+    li t0, 1 << SMP_STACK_SHIFT
+    sub t0, sp, t0
+    li t1, STACK_CANARY
+    sw t1, 0(t0)
+    addi t0, t0, 4
+    li t1, STACK_PAINT
+paint_loop:
+    bgeu t0, sp, paint_done
+    sw t1, 0(t0)
+    addi t0, t0, 4
+    j paint_loop
+paint_done:
+
+    # Any trap before the runtime installs its own handler parks the hart
+    la t0, smp_park
+    csrw mtvec, t0
+
+    bnez a0, secondary
+
+    # Hart 0: initialize BSS, then release the other harts
+    la t0, _bss_start
+    la t1, _bss_end
+bss_loop:
+    bge t0, t1, bss_done
+    sw zero, 0(t0)
+    addi t0, t0, 4
+    j bss_loop
+bss_done:
+
+    fence rw, rw
+    la t0, smp_boot_release
+    li t1, 1
+    sw t1, 0(t0)
+
+    call main
+
+    # Infinite loop
+1:  j 1b
+
+secondary:
+    # Spin until hart 0 has cleared BSS (the flag lives in .data)
+    la t0, smp_boot_release
+1:  lw t1, 0(t0)
+    beqz t1, 1b
+    fence r, rw
+
+    call smp_secondary_main
+
+.global smp_park
+.balign 4
+smp_park:
+    wfi
+    j smp_park
+
+.size _start, . - _start
+
+.section .data
+.balign 4
+.global smp_boot_release
+smp_boot_release:
+    .word 0
@@ -0,0 +1,114 @@
+#include <stdint.h>
+#include "stack.h"
+#include "riscv_csr.h"
+
+#define PMP_A_NAPOT     (3u << 3)
+#define PMP_L           (1u << 7)       // Locked: enforced in M-mode too
+
+typedef struct {
+    uint32_t *guard;
+    const char *name;
+} guard_t;
+
+static stack_region_t regions[STACK_MAX_REGIONS];
+static uint32_t num_regions = 0;
+static guard_t guards[4];
+
+void stack_paint(uint32_t *lo, uint32_t *hi) {
+    lo[0] = STACK_CANARY;
+    for (uint32_t *p = lo + 1; p < hi; p++) {
+        *p = STACK_PAINT;
+    }
+}
+
+int stack_register(const char *name, uint32_t *lo, uint32_t *hi) {
+    if (num_regions >= STACK_MAX_REGIONS) {
+        return 0;
+    }
+    regions[num_regions].name = name;
+    regions[num_regions].lo = lo;
+    regions[num_regions].hi = hi;
+    num_regions++;
+    return 1;
+}
+
+void stack_register_boot(void) {
+    if (_stack_bottom) {
+        stack_register("main", _stack_bottom, _stack_top);
+    }
+    if (_isr_stack_bottom) {
+        stack_register("isr", _isr_stack_bottom, _isr_stack_top);
+    }
+}
+
+uint32_t stack_count(void) {
+    return num_regions;
+}
+
+const stack_region_t *stack_get(uint32_t i) {
+    return i < num_regions ? &regions[i] : 0;
+}
+
+uint32_t stack_size(const stack_region_t *s) {
+    return (uint32_t)(s->hi - s->lo) * sizeof(uint32_t);
+}
+
+uint32_t stack_high_water(const stack_region_t *s) {
+    if (!stack_canary_ok(s)) {
+        return stack_size(s);
+    }
+
+    // Stacks grow down: the first word above the canary that lost its
+    // paint marks the deepest point ever reached
+    const uint32_t *p = s->lo + 1;
+    while (p < s->hi && *p == STACK_PAINT) {
+        p++;
+    }
+    return (uint32_t)(s->hi - p) * sizeof(uint32_t);
+}
+
+int stack_canary_ok(const stack_region_t *s) {
+    return s->lo[0] == STACK_CANARY;
+}
+
+int stack_guard_pmp(uint32_t entry, uint32_t *guard) {
+    // NAPOT encoding: base | (size / 2 - 1), in units of 4 bytes
+    uint32_t addr = ((uint32_t)guard | (STACK_GUARD_SIZE / 2 - 1)) >> 2;
+    uint32_t shift = entry * 8;
+
+    if (entry > 3 || ((uint32_t)guard & (STACK_GUARD_SIZE - 1))) {
+        return 0;
+    }
+
+    switch (entry) {
+    case 0: write_csr(pmpaddr0, addr); break;
+    case 1: write_csr(pmpaddr1, addr); break;
+    case 2: write_csr(pmpaddr2, addr); break;
+    case 3: write_csr(pmpaddr3, addr); break;
+    }
+
+    // R = W = X = 0: every access faults
+    uint32_t cfg = read_csr(pmpcfg0);
+    cfg &= ~(0xFFu << shift);
+    cfg |= (PMP_L | PMP_A_NAPOT) << shift;
+    write_csr(pmpcfg0, cfg);
+
+    guards[entry].guard = guard;
+    guards[entry].name = "?";
+    for (uint32_t i = 0; i < num_regions; i++) {
+        if (regions[i].lo == guard + STACK_GUARD_SIZE / 4) {
+            guards[entry].name = regions[i].name;
+        }
+    }
+    return 1;
+}
+
+const char *stack_guard_owner(uint32_t addr) {
+    for (int i = 0; i < 4; i++) {
+        uint32_t base = (uint32_t)guards[i].guard;
+        if (guards[i].guard && addr >= base && addr < base + STACK_GUARD_SIZE) {
+            return guards[i].name;
+        }
+    }
+    return 0;
+}
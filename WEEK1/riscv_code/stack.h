@@ -0,0 +1,59 @@
+#ifndef STACK_H
+#define STACK_H
+
+#include <stdint.h>
+
+// Stack measurement and overflow guards.
+//
+// Every stack is painted with STACK_PAINT (stack_start.s does main and
+// ISR before any C runs) and its lowest word holds STACK_CANARY. The
+// high-water mark is the deepest word no longer holding the paint. Below
+// each linker-placed stack sits a 64-byte guard that stack_guard_pmp()
+// turns into a locked no-access PMP region, so an overflow faults at the
+// first store instead of corrupting BSS.
+
+#define STACK_PAINT         0xA5A5A5A5u     // Must match stack_start.s
+#define STACK_CANARY        0x5AFEC0DEu
+#define STACK_GUARD_SIZE    64              // NAPOT: power of two, aligned
+#define STACK_MAX_REGIONS   8
+
+typedef struct {
+    const char *name;
+    uint32_t *lo;                           // Lowest word (canary)
+    uint32_t *hi;                           // One past the top
+} stack_region_t;
+
+// sifive_e.ld and led_blink.ld. Weak: other linker scripts define only
+// _stack_top, and the missing symbols read as 0.
+#define STACK_LD_SYM __attribute__((weak))
+extern uint32_t _stack_guard[] STACK_LD_SYM, _stack_bottom[] STACK_LD_SYM;
+extern uint32_t _stack_top[] STACK_LD_SYM;
+extern uint32_t _isr_stack_guard[] STACK_LD_SYM, _isr_stack_bottom[] STACK_LD_SYM;
+extern uint32_t _isr_stack_top[] STACK_LD_SYM;
+extern uint32_t _free_start[] STACK_LD_SYM, _free_end[] STACK_LD_SYM;
+
+// Paint a stack that is not in use (thread stacks before their first run)
+void stack_paint(uint32_t *lo, uint32_t *hi);
+
+// Track a stack for stack_report(); returns 0 if the table is full
+int stack_register(const char *name, uint32_t *lo, uint32_t *hi);
+
+// Register the main and ISR stacks from sifive_e.ld / led_blink.ld (no-op
+// elsewhere; smp_boot() registers the per-hart stacks of smp_start.s)
+void stack_register_boot(void);
+
+uint32_t stack_count(void);
+const stack_region_t *stack_get(uint32_t i);
+
+uint32_t stack_size(const stack_region_t *s);          // Bytes
+uint32_t stack_high_water(const stack_region_t *s);    // Bytes ever used
+int stack_canary_ok(const stack_region_t *s);
+
+// Locked PMP region (entry 0..3) with no access over a guard block.
+// Locked entries also apply to M-mode and stay until reset.
+int stack_guard_pmp(uint32_t entry, uint32_t *guard);
+
+// Name of the stack whose guard contains addr, or 0
+const char *stack_guard_owner(uint32_t addr);
+
+#endif /* STACK_H */
@@ -0,0 +1,133 @@
+# Startup with measured, guarded stacks (sifive_e.ld). Like trap_start.s,
+# but both stacks are painted before any C runs, and traps switch to a
+# separate interrupt stack, so an ISR frame never lands on the main stack
+# or on a thread stack.
+
+.equ STACK_PAINT,   0xA5A5A5A5      # Must match stack.h
+.equ STACK_CANARY,  0x5AFEC0DE
+
+.section .text.start
+.global _start
+
+_start:
+    # Set up stack pointer
+    la sp, _stack_top
+
+    # Copy initialized data from flash to SRAM
+    la t0, _data_load
+    la t1, _data_start
+    la t2, _data_end
+    beq t0, t1, data_done
+data_loop:
+    bge t1, t2, data_done
+    lw t3, 0(t0)
+    sw t3, 0(t1)
+    addi t0, t0, 4
+    addi t1, t1, 4
+    j data_loop
+data_done:
+
+    # Initialize BSS section
+    la t0, _bss_start
+    la t1, _bss_end
+bss_loop:
+    bge t0, t1, bss_done
+    sw zero, 0(t0)
+    addi t0, t0, 4
+    j bss_loop
+bss_done:
+
+    # Paint both stacks (nothing lives on them yet), canary in the lowest word
+    li t2, STACK_PAINT
+    li t3, STACK_CANARY
+    la t0, _stack_bottom
+    la t1, _stack_top
+    sw t3, 0(t0)
+    addi t0, t0, 4
+paint_main:
+    bge t0, t1, paint_main_done
+    sw t2, 0(t0)
+    addi t0, t0, 4
+    j paint_main
+paint_main_done:
+    la t0, _isr_stack_bottom
+    la t1, _isr_stack_top
+    sw t3, 0(t0)
+    addi t0, t0, 4
+paint_isr:
+    bge t0, t1, paint_isr_done
+    sw t2, 0(t0)
+    addi t0, t0, 4
+    j paint_isr
+paint_isr_done:
+
+    # mscratch holds the interrupt stack while running outside a trap
+    la t0, _isr_stack_top
+    csrw mscratch, t0
+
+    # Initialize trap vector (direct mode)
+    la t0, trap_entry
+    csrw mtvec, t0
+
+    # Call main program
+    call main
+
+    # Infinite loop
+1:  j 1b
+
+.size _start, . - _start
+
+# Trap entry on the interrupt stack (traps do not nest: MIE is cleared by
+# hardware and not set again in the handler). Calls
+#     void trap_dispatch(uint32_t mcause, uint32_t mepc, uint32_t mtval)
+.section .text
+.balign 4
+.global trap_entry
+trap_entry:
+    csrrw sp, mscratch, sp          # sp = interrupt stack, mscratch = old sp
+    addi sp, sp, -64
+    sw ra,  0(sp)
+    sw t0,  4(sp)
+    sw t1,  8(sp)
+    sw t2, 12(sp)
+    sw a0, 16(sp)
+    sw a1, 20(sp)
+    sw a2, 24(sp)
+    sw a3, 28(sp)
+    sw a4, 32(sp)
+    sw a5, 36(sp)
+    sw a6, 40(sp)
+    sw a7, 44(sp)
+    sw t3, 48(sp)
+    sw t4, 52(sp)
+    sw t5, 56(sp)
+    sw t6, 60(sp)
+
+    csrr a0, mcause
+    csrr a1, mepc
+    csrr a2, mtval
+    call trap_dispatch
+
+    lw ra,  0(sp)
+    lw t0,  4(sp)
+    lw t1,  8(sp)
+    lw t2, 12(sp)
+    lw a0, 16(sp)
+    lw a1, 20(sp)
+    lw a2, 24(sp)
+    lw a3, 28(sp)
+    lw a4, 32(sp)
+    lw a5, 36(sp)
+    lw a6, 40(sp)
+    lw a7, 44(sp)
+    lw t3, 48(sp)
+    lw t4, 52(sp)
+    lw t5, 56(sp)
+    lw t6, 60(sp)
+    addi sp, sp, 64
+    csrrw sp, mscratch, sp          # Back to the interrupted stack
+
+    # Return from trap
+    mret
+
+.size trap_entry, . - trap_entry
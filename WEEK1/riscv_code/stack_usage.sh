@@ -0,0 +1,111 @@
+#!/bin/bash
+# Worst-case stack depth from GCC's -fcallgraph-info=su output.
+#
+# Usage: stack_usage.sh ROOT[+EXTRA] ... [-- file.ci ...]
+#   ROOT   function the stack starts in (main, trap_dispatch, a thread entry)
+#   EXTRA  bytes pushed before ROOT runs (e.g. the 64-byte trap frame)
+#
+# Every function's own frame comes from its .ci node ("N bytes (static)");
+# the worst path is the deepest chain of calls below ROOT. Recursion,
+# indirect calls, dynamic frames and library functions without stack
+# information make the figure a lower bound, and are flagged as such.
+
+roots=()
+while [ $# -gt 0 ] && [ "$1" != "--" ]; do
+    roots+=("$1")
+    shift
+done
+[ "$1" = "--" ] && shift
+files=("$@")
+[ ${#files[@]} -eq 0 ] && files=(*.ci)
+
+if [ ${#roots[@]} -eq 0 ] || [ ! -e "${files[0]}" ]; then
+    echo "Usage: $0 ROOT[+EXTRA] ... [-- file.ci ...] (build with -fcallgraph-info=su)"
+    exit 1
+fi
+
+awk -v roots="${roots[*]}" '
+/^node:/ {
+    match($0, /title: "[^"]*"/)
+    name = substr($0, RSTART + 8, RLENGTH - 9)
+    if (!(name in known)) known[name] = 0     # Declaration only, so far
+    if (match($0, /[0-9]+ bytes \([a-z,]+\)/)) {
+        split(substr($0, RSTART, RLENGTH), f, " ")
+        frame[name] = f[1]
+        known[name] = 1
+        if (f[3] != "(static)") dynamic[name] = 1
+    }
+    next
+}
+/^edge:/ {
+    match($0, /sourcename: "[^"]*"/)
+    src = substr($0, RSTART + 13, RLENGTH - 14)
+    match($0, /targetname: "[^"]*"/)
+    dst = substr($0, RSTART + 13, RLENGTH - 14)
+    if (!((src, dst) in seen)) {
+        seen[src, dst] = 1
+        callees[src] = callees[src] " " dst
+    }
+}
+
+# Deepest path below fn; sets note[] for anything that makes it a bound
+function depth(fn,    n, list, i, d, best, via) {
+    if (fn in memo) return memo[fn]
+    if (fn in active) { flags["recursion"] = 1; return 0 }
+    if (fn == "__indirect_call") { flags["indirect call"] = 1; return 0 }
+    if (!known[fn]) { flags["no info: " fn] = 1 }
+    if (fn in dynamic) { flags["dynamic frame: " fn] = 1 }
+
+    active[fn] = 1
+    best = 0
+    via = ""
+    n = split(callees[fn], list, " ")
+    for (i = 1; i <= n; i++) {
+        d = depth(list[i])
+        if (d > best || via == "") { best = d; via = list[i] }
+    }
+    delete active[fn]
+
+    next_hop[fn] = via
+    memo[fn] = frame[fn] + best
+    return memo[fn]
+}
+
+function short(fn) {
+    sub(/^.*:/, "", fn)
+    return fn
+}
+
+END {
+    n = split(roots, r, " ")
+    printf "%-28s %8s  %s\n", "root", "bytes", "worst path"
+    for (i = 1; i <= n; i++) {
+        split(r[i], part, "+")
+        root = part[1]
+        extra = part[2] + 0
+        delete flags
+        delete memo
+
+        if (!(root in known)) {
+            # Static functions are titled "path/file.c:name"
+            for (fn in known) {
+                if (length(fn) > length(root) && \
+                    substr(fn, length(fn) - length(root)) == ":" root) root = fn
+            }
+        }
+        if (!(root in known)) {
+            printf "%-28s %8s  (not in the call graph)\n", r[i], "-"
+            continue
+        }
+        total = depth(root) + extra
+        path = short(root)
+        delete on_path
+        on_path[root] = 1
+        for (fn = next_hop[root]; fn != "" && !(fn in on_path); fn = next_hop[fn]) {
+            path = path " > " short(fn)
+            on_path[fn] = 1
+        }
+        printf "%-28s %8d  %s\n", r[i], total, path
+        for (msg in flags) printf "%-28s %8s  lower bound: %s\n", "", "", msg
+    }
+}' "${files[@]}"
@@ -3,25 +3,72 @@
 #include <sys/stat.h>
 #include <unistd.h>
 #include <errno.h>
-
-// UART register for output
-#define UART_BASE 0x10000000
-#define UART_TX_REG (*(volatile uint32_t *)(UART_BASE + 0x00))
+#include "uart_rx.h"
+#ifdef CONSOLE_SBI
+#include "sbi.h"
+#endif
+#ifdef CONSOLE_SEMIHOST
+#include <fcntl.h>
+#include "semihost.h"
+#endif
 
 // UART character output function
 void uart_putchar(char c) {
-    UART_TX_REG = (uint32_t)c;
+    reg_write(ns16550_thr, (data, c));
+}
+
+#ifdef CONSOLE_SEMIHOST
+// Console and files go to the host through semihosting. Descriptors 0-2
+// share one ":tt" handle; opened files are host handles + SH_FD_BASE.
+#define SH_FD_BASE 3
+
+static int sh_console = -1;
+
+static int sh_console_handle(void) {
+    if (sh_console < 0) {
+        sh_console = sh_open(SH_CONSOLE_NAME, SH_MODE_W);
+    }
+    return sh_console;
 }
+#endif
 
 // Retarget _write for printf
 int _write(int fd, char *buf, int len) {
+#ifdef CONSOLE_SEMIHOST
+    if (fd >= SH_FD_BASE) {
+        int n = sh_write(fd - SH_FD_BASE, buf, (uint32_t)len);
+        if (n < 0) {
+            errno = EIO;
+        }
+        return n;
+    }
+#endif
     if (fd == STDOUT_FILENO || fd == STDERR_FILENO) {
+#if defined(CONSOLE_SEMIHOST)
+        // Whole buffer in one trap, the host terminal handles line endings
+        sh_write(sh_console_handle(), buf, (uint32_t)len);
+#elif defined(CONSOLE_SBI)
+        // S-mode: the UART belongs to the firmware, write through the SBI
+        // debug console one line segment per call
+        int start = 0;
+        for (int i = 0; i < len; i++) {
+            if (buf[i] == '\n') {
+                sbi_console_write(buf + start, i + 1 - start);
+                sbi_console_putchar('\r');  // CRLF conversion
+                start = i + 1;
+            }
+        }
+        if (start < len) {
+            sbi_console_write(buf + start, len - start);
+        }
+#else
         for (int i = 0; i < len; i++) {
             uart_putchar(buf[i]);
             if (buf[i] == '\n') {
                 uart_putchar('\r');  // CRLF conversion
             }
         }
+#endif
         return len;
     }
     errno = EBADF;
@@ -30,6 +77,11 @@ int _write(int fd, char *buf, int len) {
 
 // Required syscalls for printf (minimal implementations)
 int _close(int fd) {
+#ifdef CONSOLE_SEMIHOST
+    if (fd >= SH_FD_BASE) {
+        return (sh_close(fd - SH_FD_BASE) == 0) ? 0 : -1;
+    }
+#endif
     errno = EBADF;
     return -1;
 }
@@ -39,6 +91,12 @@ int _fstat(int fd, struct stat *st) {
         st->st_mode = S_IFCHR;  // Character device
         return 0;
     }
+#ifdef CONSOLE_SEMIHOST
+    if (fd >= SH_FD_BASE) {
+        st->st_mode = S_IFREG;  // Host file
+        return 0;
+    }
+#endif
     errno = EBADF;
     return -1;
 }
@@ -52,7 +110,62 @@ off_t _lseek(int fd, off_t offset, int whence) {
     return -1;
 }
 
+// Retarget _read for scanf/fgets: blocks until console data arrives
 ssize_t _read(int fd, void *buf, size_t len) {
-    errno = EBADF;  // Not implemented
+    if (fd == STDIN_FILENO) {
+#ifdef CONSOLE_SBI
+        // S-mode: poll the firmware's console, the UART is not ours
+        int n;
+        do {
+            n = sbi_console_read((char *)buf, (int)len);
+        } while (n == 0 && len > 0);
+        if (n < 0) {
+            errno = EIO;
+        }
+        return n;
+#else
+        return uart_rx_read((char *)buf, (int)len);
+#endif
+    }
+#ifdef CONSOLE_SEMIHOST
+    if (fd >= SH_FD_BASE) {
+        int n = sh_read(fd - SH_FD_BASE, buf, (uint32_t)len);
+        if (n < 0) {
+            errno = EIO;
+        }
+        return n;
+    }
+#endif
+    errno = EBADF;
     return -1;
 }
+
+#ifdef CONSOLE_SEMIHOST
+// fopen() on the host file system (paths relative to QEMU's directory)
+int _open(const char *name, int flags, int mode) {
+    uint32_t sh_mode;
+    (void)mode;
+
+    if ((flags & O_ACCMODE) == O_RDONLY) {
+        sh_mode = SH_MODE_RB;
+    } else if (flags & O_APPEND) {
+        sh_mode = (flags & O_ACCMODE) == O_RDWR ? SH_MODE_AB_PLUS : SH_MODE_AB;
+    } else if (flags & O_TRUNC) {
+        sh_mode = (flags & O_ACCMODE) == O_RDWR ? SH_MODE_WB_PLUS : SH_MODE_WB;
+    } else {
+        sh_mode = SH_MODE_RB_PLUS;  // Read/write, no truncation
+    }
+
+    int handle = sh_open(name, sh_mode);
+    if (handle < 0) {
+        errno = sh_errno();
+        return -1;
+    }
+    return handle + SH_FD_BASE;
+}
+
+// exit()/return from main: report the status to the host and stop QEMU
+void _exit(int status) {
+    sh_exit(status);
+}
+#endif
@@ -1,11 +1,5 @@
 #include <stdint.h>
-
-// Memory-mapped timer registers (QEMU virt machine)
-#define MTIME_BASE 0x0200BFF8
-#define MTIMECMP_BASE 0x02004000
-
-volatile uint64_t *mtime = (volatile uint64_t *)MTIME_BASE;
-volatile uint64_t *mtimecmp = (volatile uint64_t *)MTIMECMP_BASE;
+#include "clocksource.h"    // Tear-free mtime read, safe mtimecmp update
 
 // Global counter for interrupt handling
 volatile uint32_t interrupt_count = 0;
@@ -13,7 +7,7 @@ volatile uint32_t interrupt_count = 0;
 // Timer interrupt handler with interrupt attribute
 void __attribute__((interrupt)) timer_interrupt_handler(void) {
     // Clear timer interrupt by setting next compare value
-    *mtimecmp = *mtime + 10000000;  // Next interrupt in ~1 second (assuming 10MHz)
+    mtimecmp_write(0, mtime_read() + TIMEBASE_HZ);  // Next interrupt in 1 second
     
     // Increment interrupt counter
     interrupt_count++;
@@ -47,7 +41,7 @@ static inline void write_csr_mtvec(uint32_t value) {
 
 void enable_timer_interrupt(void) {
     // Set initial timer compare value
-    *mtimecmp = *mtime + 10000000;  // First interrupt in ~1 second
+    mtimecmp_write(0, mtime_read() + TIMEBASE_HZ);  // First interrupt in 1 second
     
     // Set interrupt vector (direct mode)
     write_csr_mtvec((uint32_t)timer_interrupt_handler);
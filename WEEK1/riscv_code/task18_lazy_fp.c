@@ -0,0 +1,172 @@
+#include <stdio.h>
+#include <stdint.h>
+#include "riscv_csr.h"
+#include "fp_context.h"
+#include "regmap.h"
+
+#define SWITCH_ROUNDS       1000
+#define IRQ_ROUNDS          100
+#define WORKER_STACK_WORDS  1024
+
+static thread_t main_thread;
+static thread_t worker_thread;
+static uint32_t worker_stack[WORKER_STACK_WORDS] __attribute__((aligned(16)));
+
+// What each side does between yields
+static volatile int worker_uses_fp = 0;
+volatile uint32_t int_sink = 1;
+volatile double fp_sink = 1.0;
+
+// Software interrupt bookkeeping
+volatile uint32_t irq_entry_cycle = 0;
+volatile uint32_t irq_seen = 0;
+
+// Integer-only: runs from trap_dispatch with FS possibly Off
+void machine_irq_handler(uint32_t irq) {
+    if (irq == IRQ_M_SOFT) {
+        irq_entry_cycle = rdcycle();
+        reg_write(clint_msip0, (msip, 0));     // Clear the pending software interrupt
+        irq_seen = 1;
+    }
+}
+
+// One double multiply-add: enough to mark mstatus.FS Dirty
+static void fp_work(void) {
+    double x = fp_sink;
+    x = x * 1.000001 + 0.5;
+    fp_sink = x;
+}
+
+static void int_work(void) {
+    int_sink = int_sink * 3 + 1;
+}
+
+static void worker_entry(void) {
+    while (1) {
+        if (worker_uses_fp) {
+            fp_work();
+        } else {
+            int_work();
+        }
+        thread_yield();
+    }
+}
+
+typedef struct {
+    uint32_t cycles_per_switch;
+    uint32_t fp_saves;
+    uint32_t fp_restores;
+    uint32_t lazy_traps;
+} switch_result_t;
+
+// Ping-pong between main and the worker, 2 switches per round
+static switch_result_t bench_switch(fp_policy_t policy, int main_fp, int worker_fp) {
+    switch_result_t r;
+
+    fp_set_policy(policy);
+    worker_uses_fp = worker_fp;
+
+    // Warm up so the FP owner reaches its steady state
+    for (int i = 0; i < 4; i++) {
+        if (main_fp) fp_work(); else int_work();
+        thread_yield();
+    }
+
+    uint32_t saves = main_thread.fp_saves + worker_thread.fp_saves;
+    uint32_t restores = main_thread.fp_restores + worker_thread.fp_restores;
+    uint32_t traps = fp_lazy_traps();
+    uint32_t start = rdcycle();
+
+    for (int i = 0; i < SWITCH_ROUNDS; i++) {
+        if (main_fp) fp_work(); else int_work();
+        thread_yield();
+    }
+
+    uint32_t cycles = rdcycle() - start;
+
+    r.cycles_per_switch = cycles / (2 * SWITCH_ROUNDS);
+    r.fp_saves = main_thread.fp_saves + worker_thread.fp_saves - saves;
+    r.fp_restores = main_thread.fp_restores + worker_thread.fp_restores - restores;
+    r.lazy_traps = fp_lazy_traps() - traps;
+    return r;
+}
+
+// Software interrupt latency: MSIP write -> first C instruction of the ISR
+static void bench_irq(fp_policy_t policy, int fp_active,
+                      uint32_t *entry_cycles, uint32_t *round_trip_cycles) {
+    uint32_t entry_total = 0;
+    uint32_t total = 0;
+
+    fp_set_policy(policy);
+
+    for (int i = 0; i < IRQ_ROUNDS; i++) {
+        if (fp_active) fp_work();
+
+        irq_seen = 0;
+        uint32_t start = rdcycle();
+        reg_write(clint_msip0, (msip, 1));
+        while (!irq_seen) {
+            // Interrupt is taken here
+        }
+        uint32_t end = rdcycle();
+
+        entry_total += irq_entry_cycle - start;
+        total += end - start;
+    }
+
+    *entry_cycles = entry_total / IRQ_ROUNDS;
+    *round_trip_cycles = total / IRQ_ROUNDS;
+}
+
+static const char *policy_name(fp_policy_t policy) {
+    return (policy == FP_POLICY_EAGER) ? "eager" : "lazy ";
+}
+
+int main() {
+    static const struct {
+        int main_fp;
+        int worker_fp;
+    } mixes[] = { {0, 0}, {0, 1}, {1, 1} };
+
+    printf("=== Task 18: Lazy FP Context Switching (mstatus.FS) ===\n\n");
+
+    sched_init(&main_thread);
+    thread_create(&worker_thread, "worker", worker_entry,
+                  worker_stack, WORKER_STACK_WORDS);
+
+    // Enable machine software interrupts for the latency test
+    set_csr(mie, MIP_MSIP);
+    set_csr(mstatus, MSTATUS_MIE);
+
+    printf("Context switch (%d rounds, 2 switches each)\n", SWITCH_ROUNDS);
+    printf("policy  main  worker  cycles/switch  fp_saves  fp_restores  fs_traps\n");
+    for (int p = 0; p < 2; p++) {
+        fp_policy_t policy = p ? FP_POLICY_LAZY : FP_POLICY_EAGER;
+        for (unsigned m = 0; m < sizeof(mixes) / sizeof(mixes[0]); m++) {
+            switch_result_t r = bench_switch(policy, mixes[m].main_fp, mixes[m].worker_fp);
+            printf("%s   %s   %s     %8u      %6u    %6u       %6u\n",
+                   policy_name(policy),
+                   mixes[m].main_fp ? "fp " : "int",
+                   mixes[m].worker_fp ? "fp " : "int",
+                   (unsigned)r.cycles_per_switch, (unsigned)r.fp_saves,
+                   (unsigned)r.fp_restores, (unsigned)r.lazy_traps);
+        }
+    }
+
+    printf("\nSoftware interrupt latency (%d samples)\n", IRQ_ROUNDS);
+    printf("policy  interrupted  entry_cycles  round_trip_cycles\n");
+    for (int p = 0; p < 2; p++) {
+        fp_policy_t policy = p ? FP_POLICY_LAZY : FP_POLICY_EAGER;
+        for (int fp_active = 0; fp_active < 2; fp_active++) {
+            uint32_t entry, round_trip;
+            bench_irq(policy, fp_active, &entry, &round_trip);
+            printf("%s   %s          %8u      %8u\n",
+                   policy_name(policy), fp_active ? "fp " : "int",
+                   (unsigned)entry, (unsigned)round_trip);
+        }
+    }
+
+    clear_csr(mstatus, MSTATUS_MIE);
+    printf("\nLazy FP benchmark complete\n");
+    return 0;
+}
@@ -0,0 +1,203 @@
+#include <stdio.h>
+#include <stdint.h>
+#include "riscv_csr.h"
+#include "endian_lib.h"
+
+#define NUM_RECORDS 256
+
+// Same layouts as task17_endianness.c
+struct regular_struct {
+    uint8_t  a;    // 1 byte
+    uint32_t b;    // 4 bytes (3 bytes padding after 'a')
+    uint16_t c;    // 2 bytes
+    uint8_t  d;    // 1 byte (1 byte padding at the end)
+};
+
+struct __attribute__((packed)) packed_struct {
+    uint8_t  a;    // 1 byte
+    uint32_t b;    // 4 bytes (misaligned at offset 1)
+    uint16_t c;    // 2 bytes
+    uint8_t  d;    // 1 byte
+};
+
+// Wire description of the same record: 8 bytes, little-endian
+#define SAMPLE_LE_FIELDS(X)     \
+    X(uint8_t,  a,  8, le)      \
+    X(uint32_t, b, 32, le)      \
+    X(uint16_t, c, 16, le)      \
+    X(uint8_t,  d,  8, le)
+WIRE_STRUCT(sample_le, SAMPLE_LE_FIELDS)
+
+// Same record in network byte order
+#define SAMPLE_BE_FIELDS(X)     \
+    X(uint8_t,  a,  8, be)      \
+    X(uint32_t, b, 32, be)      \
+    X(uint16_t, c, 16, be)      \
+    X(uint8_t,  d,  8, be)
+WIRE_STRUCT(sample_be, SAMPLE_BE_FIELDS)
+
+_Static_assert(sizeof(struct regular_struct) == 12, "regular layout");
+_Static_assert(sizeof(struct packed_struct) == 8, "packed layout");
+_Static_assert(sample_le_WIRE_SIZE == 8, "wire layout");
+
+static struct regular_struct regular[NUM_RECORDS];
+static struct packed_struct packed[NUM_RECORDS];
+static uint8_t wire_le[NUM_RECORDS * sample_le_WIRE_SIZE];
+static uint8_t wire_be[NUM_RECORDS * sample_be_WIRE_SIZE];
+static uint32_t words_be[NUM_RECORDS];
+
+static int failures = 0;
+
+static void check(const char *what, uint32_t got, uint32_t expected) {
+    if (got != expected) {
+        printf("FAIL %s: got 0x%08X expected 0x%08X\n", what,
+               (unsigned)got, (unsigned)expected);
+        failures++;
+    }
+}
+
+static void fill_records(void) {
+    uint32_t seed = 0x12345678;
+
+    for (int i = 0; i < NUM_RECORDS; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        regular[i].a = (uint8_t)seed;
+        regular[i].b = seed ^ 0xA5A5A5A5u;
+        regular[i].c = (uint16_t)(seed >> 8);
+        regular[i].d = (uint8_t)(seed >> 24);
+
+        packed[i].a = regular[i].a;
+        packed[i].b = regular[i].b;
+        packed[i].c = regular[i].c;
+        packed[i].d = regular[i].d;
+
+        struct sample_le le = { regular[i].a, regular[i].b, regular[i].c, regular[i].d };
+        struct sample_be be = { regular[i].a, regular[i].b, regular[i].c, regular[i].d };
+        sample_le_encode(&le, &wire_le[i * sample_le_WIRE_SIZE]);
+        sample_be_encode(&be, &wire_be[i * sample_be_WIRE_SIZE]);
+        store_be32(&words_be[i], regular[i].b);
+    }
+}
+
+// Checksum helpers: noinline so each variant is measured as written
+static __attribute__((noinline)) uint32_t sum_aligned(void) {
+    uint32_t sum = 0;
+    for (int i = 0; i < NUM_RECORDS; i++) {
+        sum += regular[i].a + regular[i].b + regular[i].c + regular[i].d;
+    }
+    return sum;
+}
+
+static __attribute__((noinline)) uint32_t sum_packed(void) {
+    uint32_t sum = 0;
+    for (int i = 0; i < NUM_RECORDS; i++) {
+        sum += packed[i].a + PACKED_GET(&packed[i], b) +
+               PACKED_GET(&packed[i], c) + packed[i].d;
+    }
+    return sum;
+}
+
+static __attribute__((noinline)) uint32_t sum_decode_le(void) {
+    uint32_t sum = 0;
+    for (int i = 0; i < NUM_RECORDS; i++) {
+        struct sample_le m;
+        sample_le_decode(&m, &wire_le[i * sample_le_WIRE_SIZE]);
+        sum += m.a + m.b + m.c + m.d;
+    }
+    return sum;
+}
+
+static __attribute__((noinline)) uint32_t sum_decode_be(void) {
+    uint32_t sum = 0;
+    for (int i = 0; i < NUM_RECORDS; i++) {
+        struct sample_be m;
+        sample_be_decode(&m, &wire_be[i * sample_be_WIRE_SIZE]);
+        sum += m.a + m.b + m.c + m.d;
+    }
+    return sum;
+}
+
+static __attribute__((noinline)) void encode_all_le(void) {
+    for (int i = 0; i < NUM_RECORDS; i++) {
+        struct sample_le m = { regular[i].a, regular[i].b, regular[i].c, regular[i].d };
+        sample_le_encode(&m, &wire_le[i * sample_le_WIRE_SIZE]);
+    }
+}
+
+static __attribute__((noinline)) uint32_t sum_be_words_bytes(void) {
+    uint32_t sum = 0;
+    for (int i = 0; i < NUM_RECORDS; i++) {
+        sum += load_be32(&words_be[i]);         // 4 x lbu + shifts
+    }
+    return sum;
+}
+
+static __attribute__((noinline)) uint32_t sum_be_words_aligned(void) {
+    uint32_t sum = 0;
+    for (int i = 0; i < NUM_RECORDS; i++) {
+        sum += load_be32_aligned(&words_be[i]); // lw + bswap32 (rev8 with Zbb)
+    }
+    return sum;
+}
+
+static void test_bswap(void) {
+    check("bswap16", bswap16(0x1234), 0x3412);
+    check("bswap32", bswap32(0x01020304), 0x04030201);
+    check("bswap64 lo", (uint32_t)bswap64(0x0102030405060708ULL), 0x04030201);
+    check("bswap64 hi", (uint32_t)(bswap64(0x0102030405060708ULL) >> 32), 0x08070605);
+
+    uint8_t buf[9];
+    store_be64(buf + 1, 0x0102030405060708ULL);  // Deliberately misaligned
+    check("store_be64", buf[1] | (buf[8] << 8), 0x0801);
+    check("load_le64", (uint32_t)load_le64(buf + 1), 0x04030201);
+    check("load_be16", load_be16(buf + 1), 0x0102);
+    check("unaligned32", load_unaligned32(&packed[0].b), regular[0].b);
+}
+
+#define MEASURE(label, expr) do {                                        \
+    uint32_t start = rdcycle();                                          \
+    result = (expr);                                                     \
+    uint32_t cycles = rdcycle() - start;                                 \
+    printf("%-28s %6u cycles  %4u.%02u cycles/record\n", label,          \
+           (unsigned)cycles, (unsigned)(cycles / NUM_RECORDS),           \
+           (unsigned)((cycles % NUM_RECORDS) * 100 / NUM_RECORDS));      \
+} while (0)
+
+int main() {
+    uint32_t result;
+
+    printf("=== Task 19: Endian & Serialization Library ===\n");
+#if defined(__riscv_zbb)
+    printf("bswap: Zbb rev8\n");
+#else
+    printf("bswap: shift/mask fallback\n");
+#endif
+    printf("regular %u bytes, packed %u bytes, wire %u bytes\n\n",
+           (unsigned)sizeof(struct regular_struct),
+           (unsigned)sizeof(struct packed_struct),
+           (unsigned)sample_le_WIRE_SIZE);
+
+    fill_records();
+    test_bswap();
+
+    uint32_t expected = sum_aligned();
+
+    MEASURE("aligned struct fields", sum_aligned());
+    check("aligned", result, expected);
+    MEASURE("packed struct fields", sum_packed());
+    check("packed", result, expected);
+    MEASURE("decode LE wire copy", sum_decode_le());
+    check("decode le", result, expected);
+    MEASURE("decode BE wire copy", sum_decode_be());
+    check("decode be", result, expected);
+    MEASURE("encode LE wire copy", (encode_all_le(), 0));
+
+    uint32_t expected_b = sum_be_words_bytes();
+    MEASURE("BE u32 via byte loads", sum_be_words_bytes());
+    check("be bytes", result, expected_b);
+    MEASURE("BE u32 via lw + bswap32", sum_be_words_aligned());
+    check("be aligned", result, expected_b);
+
+    printf("\n%s (%d failures)\n", failures ? "FAILED" : "All checks passed", failures);
+    return failures;
+}
@@ -0,0 +1,162 @@
+#include <stdio.h>
+#include <stdint.h>
+#include "riscv_csr.h"
+#include "plic.h"
+#include "uart_rx.h"
+
+#define WORK_BUF_SIZE 1024
+
+static uint32_t bench_iters = 16;
+static uint8_t work_buf[WORK_BUF_SIZE];
+
+// Trap handler: only the UART external interrupt is expected
+void trap_dispatch(uint32_t mcause, uint32_t mepc, uint32_t mtval) {
+    if (mcause == (MCAUSE_INTERRUPT | IRQ_M_EXT)) {
+        uint32_t irq = plic_claim(PLIC_CTX_M_HART0);
+        if (irq == UART0_IRQ) {
+            uart_rx_isr();
+        }
+        if (irq) {
+            plic_complete(PLIC_CTX_M_HART0, irq);
+        }
+        return;
+    }
+
+    // Unexpected exception: park the hart (inspect with GDB)
+    (void)mepc;
+    (void)mtval;
+    while (1) {
+        asm volatile ("wfi");
+    }
+}
+
+// Does the line start with the given word (followed by end or space)?
+static int line_is_cmd(const uart_line_t *line, const char *word) {
+    uint32_t len = uart_line_length(line);
+    uint32_t i = 0;
+
+    for (; word[i]; i++) {
+        if (i >= len || uart_line_at(line, i) != word[i]) {
+            return 0;
+        }
+    }
+    return i == len || uart_line_at(line, i) == ' ';
+}
+
+// Parse an unsigned decimal argument after the command word
+static int line_arg_uint(const uart_line_t *line, uint32_t *value) {
+    uint32_t len = uart_line_length(line);
+    uint32_t i = 0;
+    uint32_t v = 0;
+    int digits = 0;
+
+    while (i < len && uart_line_at(line, i) != ' ') i++;
+    while (i < len && uart_line_at(line, i) == ' ') i++;
+
+    for (; i < len; i++) {
+        char c = uart_line_at(line, i);
+        if (c < '0' || c > '9') {
+            return 0;
+        }
+        v = v * 10 + (uint32_t)(c - '0');
+        digits++;
+    }
+
+    if (digits) {
+        *value = v;
+    }
+    return digits != 0;
+}
+
+static void run_benchmark(void) {
+    uint32_t sum = 0;
+    uint32_t start = rdcycle();
+
+    for (uint32_t n = 0; n < bench_iters; n++) {
+        for (int i = 0; i < WORK_BUF_SIZE; i++) {
+            sum += work_buf[i] ^ (uint8_t)n;
+        }
+    }
+
+    uint32_t cycles = rdcycle() - start;
+    printf("checksum 0x%08X, %u iterations, %u cycles\n",
+           (unsigned)sum, (unsigned)bench_iters, (unsigned)cycles);
+}
+
+static void print_stats(void) {
+    uart_rx_stats_t stats;
+    uart_rx_get_stats(&stats);
+    printf("rx bytes %u, overruns %u, max ring fill %u/%u\n",
+           (unsigned)stats.received, (unsigned)stats.overruns,
+           (unsigned)stats.max_fill, UART_RX_BUF_SIZE);
+}
+
+static void print_help(void) {
+    printf("Commands:\n");
+    printf("  iters <n>  set benchmark iterations\n");
+    printf("  run        run checksum benchmark\n");
+    printf("  stats      show UART receive statistics\n");
+    printf("  gets       read one line through stdio (fgets -> _read)\n");
+    printf("  quit       leave the shell\n");
+}
+
+int main() {
+    for (int i = 0; i < WORK_BUF_SIZE; i++) {
+        work_buf[i] = (uint8_t)(i * 7);
+    }
+
+    uart_rx_init();
+    uart_rx_set_echo(1);
+
+    printf("=== Task 20: Interrupt-Driven UART Receive ===\n");
+    print_help();
+
+    while (1) {
+        uart_line_t line;
+
+        printf("> ");
+        fflush(stdout);
+
+        // Blocks in wfi; the line stays in the ring until released
+        uart_rx_line_get(&line);
+
+        if (uart_line_length(&line) == 0) {
+            // Empty line
+        } else if (line_is_cmd(&line, "iters")) {
+            if (line_arg_uint(&line, &bench_iters)) {
+                printf("iterations = %u\n", (unsigned)bench_iters);
+            } else {
+                printf("usage: iters <n>\n");
+            }
+        } else if (line_is_cmd(&line, "run")) {
+            run_benchmark();
+        } else if (line_is_cmd(&line, "stats")) {
+            print_stats();
+        } else if (line_is_cmd(&line, "gets")) {
+            char buf[64];
+            uart_rx_line_release();
+            printf("type a line: ");
+            fflush(stdout);
+            if (fgets(buf, sizeof(buf), stdin)) {
+                printf("fgets returned: %s", buf);
+            }
+            continue;
+        } else if (line_is_cmd(&line, "quit")) {
+            uart_rx_line_release();
+            break;
+        } else if (line_is_cmd(&line, "help")) {
+            print_help();
+        } else {
+            printf("unknown command (%u bytes", (unsigned)uart_line_length(&line));
+            if (line.wrap_len) {
+                printf(", wraps the ring");
+            }
+            printf(")\n");
+        }
+
+        uart_rx_line_release();
+    }
+
+    printf("bye\n");
+    return 0;
+}
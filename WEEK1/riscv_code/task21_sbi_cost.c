@@ -0,0 +1,140 @@
+#include <stdio.h>
+#include <stdint.h>
+#include "riscv_csr.h"
+#include "runtime.h"
+#ifdef RUNTIME_SMODE
+#include "sbi.h"
+#endif
+
+#define ROUNDS      256
+#define WRITE_LEN   64
+#define FAR_FUTURE  0xFFFFFFFFFFFFull
+
+static volatile uint32_t soft_irqs = 0;
+static char line_buf[WRITE_LEN];
+
+// Interrupt callback from the runtime's trap_dispatch()
+void rt_irq_handler(uint32_t irq) {
+    if (irq == RT_IRQ_SOFT) {
+        soft_irqs++;
+    }
+}
+
+static void report(const char *name, uint32_t total) {
+    printf("  %-28s %6lu cycles/op\n", name, (unsigned long)(total / ROUNDS));
+}
+
+static uint32_t bench_time_read(void) {
+    volatile uint64_t sink;
+    uint32_t start = rdcycle();
+    for (int i = 0; i < ROUNDS; i++) {
+        sink = rt_time();
+    }
+    (void)sink;
+    return rdcycle() - start;
+}
+
+static uint32_t bench_set_timer(void) {
+    uint32_t start = rdcycle();
+    for (int i = 0; i < ROUNDS; i++) {
+        rt_set_timer(FAR_FUTURE + (uint64_t)i);
+    }
+    return rdcycle() - start;
+}
+
+// Send an IPI to ourselves and spin until the handler has run
+static uint32_t bench_self_ipi(void) {
+    uint32_t hart = rt_hartid();
+    uint32_t start = rdcycle();
+    for (int i = 0; i < ROUNDS; i++) {
+        uint32_t seen = soft_irqs;
+        rt_send_ipi(hart);
+        while (soft_irqs == seen) {
+        }
+    }
+    return rdcycle() - start;
+}
+
+// Console output is measured with a NUL byte so the terminal stays readable
+static uint32_t bench_putc(void) {
+    uint32_t start = rdcycle();
+    for (int i = 0; i < ROUNDS; i++) {
+        rt_console_putc('\0');
+    }
+    return rdcycle() - start;
+}
+
+static uint32_t bench_write(void) {
+    uint32_t start = rdcycle();
+    for (int i = 0; i < ROUNDS; i++) {
+        rt_console_write(line_buf, WRITE_LEN);
+    }
+    return rdcycle() - start;
+}
+
+#ifdef RUNTIME_SMODE
+// Round trip into OpenSBI and back with no work done there
+static uint32_t bench_null_ecall(void) {
+    uint32_t start = rdcycle();
+    for (int i = 0; i < ROUNDS; i++) {
+        sbi_ecall(SBI_EXT_BASE, SBI_BASE_GET_SPEC_VERSION, 0, 0, 0);
+    }
+    return rdcycle() - start;
+}
+
+// OpenSBI leaves the UART accessible to S-mode, so a direct store works
+static uint32_t bench_direct_putc(void) {
+    uint32_t start = rdcycle();
+    for (int i = 0; i < ROUNDS; i++) {
+        *(volatile uint8_t *)RT_UART_THR = 0;
+    }
+    return rdcycle() - start;
+}
+
+static uint32_t bench_sbi_set_timer(void) {
+    uint32_t start = rdcycle();
+    for (int i = 0; i < ROUNDS; i++) {
+        sbi_set_timer(FAR_FUTURE + (uint64_t)i);
+    }
+    return rdcycle() - start;
+}
+#endif
+
+int main(void) {
+    rt_init();
+
+    for (int i = 0; i < WRITE_LEN; i++) {
+        line_buf[i] = '\0';
+    }
+
+    printf("=== Task 21: Runtime Call Cost ===\n");
+    printf("Mode:   %s, hart %lu\n", rt_mode_name(), (unsigned long)rt_hartid());
+#ifdef RUNTIME_SMODE
+    uint32_t ver = sbi_spec_version();
+    printf("SBI:    v%lu.%lu, DBCN %s, Sstc %s\n",
+           (unsigned long)((ver >> 24) & 0x7F), (unsigned long)(ver & 0xFFFFFF),
+           sbi_has_dbcn() ? "yes" : "no", rt_has_sstc() ? "yes" : "no");
+#endif
+    printf("Rounds: %d\n\n", ROUNDS);
+
+    rt_enable_irq(RT_IRQ_SOFT);
+
+    printf("Runtime operations:\n");
+    report("rt_time()", bench_time_read());
+    report("rt_set_timer()", bench_set_timer());
+    report("rt_send_ipi() round trip", bench_self_ipi());
+    report("rt_console_putc()", bench_putc());
+    report("rt_console_write(64 bytes)", bench_write());
+
+#ifdef RUNTIME_SMODE
+    printf("\nS-mode reference points:\n");
+    report("null ecall (spec version)", bench_null_ecall());
+    report("direct UART THR store", bench_direct_putc());
+    report("sbi_set_timer()", bench_sbi_set_timer());
+#endif
+
+    rt_set_timer(UINT64_MAX);
+    printf("\nDone, %lu software interrupts taken.\n", (unsigned long)soft_irqs);
+    rt_exit(0);
+    return 0;
+}
@@ -0,0 +1,143 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "riscv_csr.h"
+#include "semihost.h"
+#include "clocksource.h"
+
+#define SAMPLES     4096
+#define BINS        64
+#define TABLE_SIZE  4096
+
+void uart_putchar(char c);  // syscalls.c
+
+static uint32_t histogram[BINS];
+static char table[TABLE_SIZE];
+
+typedef struct {
+    uint32_t cycles;
+    uint32_t ticks;
+} cost_t;
+
+// Fill the histogram with a deterministic pseudo-random distribution
+// (sum of two uniform values, so the shape is a triangle)
+static void build_histogram(void) {
+    uint32_t x = 12345;
+    for (int i = 0; i < SAMPLES; i++) {
+        x = x * 1103515245u + 12345u;
+        uint32_t a = (x >> 16) % (BINS / 2);
+        x = x * 1103515245u + 12345u;
+        uint32_t b = (x >> 16) % (BINS / 2);
+        histogram[a + b]++;
+    }
+}
+
+// Render the histogram as CSV, returns the length
+static int format_table(void) {
+    int len = snprintf(table, TABLE_SIZE, "bin,count\n");
+    for (int i = 0; i < BINS && len < TABLE_SIZE; i++) {
+        len += snprintf(table + len, TABLE_SIZE - len, "%d,%lu\n",
+                        i, (unsigned long)histogram[i]);
+    }
+    return len;
+}
+
+static cost_t cost_begin(void) {
+    cost_t c = { rdcycle(), MTIME_LO };
+    return c;
+}
+
+static cost_t cost_end(cost_t start) {
+    cost_t c = { rdcycle() - start.cycles, MTIME_LO - start.ticks };
+    return c;
+}
+
+static void report(const char *name, cost_t c, int len) {
+    printf("  %-24s %8lu cycles %6lu ticks  (%lu.%02lu cycles/byte)\n", name,
+           (unsigned long)c.cycles, (unsigned long)c.ticks,
+           (unsigned long)(c.cycles / len),
+           (unsigned long)((c.cycles % len) * 100 / len));
+}
+
+int main(void) {
+    int failures = 0;
+    cost_t c;
+
+    printf("=== Task 22: Semihosting Fast I/O ===\n");
+    uint32_t t0 = sh_clock();
+
+    build_histogram();
+    int len = format_table();
+    printf("Histogram: %d samples, %d bins, %d bytes of CSV\n\n", SAMPLES, BINS, len);
+
+    // 1. Byte-at-a-time UART, as every earlier demo does
+    c = cost_begin();
+    for (int i = 0; i < len; i++) {
+        uart_putchar(table[i]);
+        if (table[i] == '\n') {
+            uart_putchar('\r');
+        }
+    }
+    cost_t uart_cost = cost_end(c);
+
+    // 2. Same table to the host console in one SYS_WRITE
+    int tt = sh_open(SH_CONSOLE_NAME, SH_MODE_W);
+    c = cost_begin();
+    int n = sh_write(tt, table, (uint32_t)len);
+    cost_t tt_cost = cost_end(c);
+    if (n != len) {
+        printf("ERROR: console SYS_WRITE wrote %d of %d bytes\n", n, len);
+        failures++;
+    }
+
+    // 3. Straight into a host file with the raw semihosting calls
+    c = cost_begin();
+    int fh = sh_open("task22_histogram.csv", SH_MODE_WB);
+    n = (fh >= 0) ? sh_write(fh, table, (uint32_t)len) : -1;
+    if (fh >= 0) {
+        sh_close(fh);
+    }
+    cost_t file_cost = cost_end(c);
+    if (n != len) {
+        printf("ERROR: task22_histogram.csv: wrote %d of %d bytes (errno %d)\n",
+               n, len, sh_errno());
+        failures++;
+    }
+
+    // 4. Through newlib stdio (fopen -> _open -> SYS_OPEN)
+    c = cost_begin();
+    FILE *f = fopen("task22_histogram_stdio.csv", "w");
+    if (f) {
+        fwrite(table, 1, (size_t)len, f);
+        fclose(f);
+    } else {
+        printf("ERROR: fopen failed\n");
+        failures++;
+    }
+    cost_t stdio_cost = cost_end(c);
+
+    // Check the file by reading it back
+    char check[64];
+    fh = sh_open("task22_histogram.csv", SH_MODE_RB);
+    if (fh < 0 || sh_read(fh, check, sizeof(check)) != (int)sizeof(check) ||
+        memcmp(check, table, sizeof(check)) != 0) {
+        printf("ERROR: read-back of task22_histogram.csv does not match\n");
+        failures++;
+    }
+    if (fh >= 0) {
+        sh_close(fh);
+    }
+
+    printf("\nOutput cost for %d bytes:\n", len);
+    report("UART uart_putchar()", uart_cost, len);
+    report("SYS_WRITE to :tt", tt_cost, len);
+    report("SYS_OPEN/WRITE/CLOSE", file_cost, len);
+    report("fopen/fwrite/fclose", stdio_cost, len);
+
+    printf("\nElapsed (SYS_CLOCK): %lu cs\n", (unsigned long)(sh_clock() - t0));
+    printf("Exiting with status %d\n", failures);
+
+    // exit() flushes stdio and ends in _exit() -> SYS_EXIT_EXTENDED
+    exit(failures);
+}
@@ -0,0 +1,204 @@
+#include <stdio.h>
+#include <stdint.h>
+#include "riscv_csr.h"
+#include "clocksource.h"
+
+#define ROUNDS      1000
+#define TRIALS      100
+#define MONO_READS  100000
+
+// Inputs kept in memory so the compiler cannot fold the conversions
+static volatile uint64_t sample_ticks[8] = {
+    0, 1, 9999999, 10000000, 0xFFFFFFFFull, 0x100000000ull,
+    123456789012345ull, 0x00FFFFFFFFFFFFFFull,
+};
+
+static clock_conv_t tick_to_ns;
+static clock_conv_t cycle_to_ns;
+
+static void report(const char *name, uint32_t cycles) {
+    printf("  %-30s %5lu cycles/op\n", name, (unsigned long)(cycles / ROUNDS));
+}
+
+// The task13 way: a 64-bit volatile access, two loads with no retry
+static uint32_t bench_naive_read(void) {
+    volatile uint64_t *mtime = (volatile uint64_t *)MTIME_BASE;
+    volatile uint64_t sink;
+    uint32_t start = rdcycle();
+    for (int i = 0; i < ROUNDS; i++) {
+        sink = *mtime;
+    }
+    (void)sink;
+    return rdcycle() - start;
+}
+
+static uint32_t bench_mtime_read(void) {
+    volatile uint64_t sink;
+    uint32_t start = rdcycle();
+    for (int i = 0; i < ROUNDS; i++) {
+        sink = mtime_read();
+    }
+    (void)sink;
+    return rdcycle() - start;
+}
+
+static uint32_t bench_mtime_read_lo(void) {
+    volatile uint32_t sink;
+    uint32_t start = rdcycle();
+    for (int i = 0; i < ROUNDS; i++) {
+        sink = mtime_read_lo();
+    }
+    (void)sink;
+    return rdcycle() - start;
+}
+
+static uint32_t bench_rdtime64(void) {
+    volatile uint64_t sink;
+    uint32_t start = rdcycle();
+    for (int i = 0; i < ROUNDS; i++) {
+        sink = rdtime64();
+    }
+    (void)sink;
+    return rdcycle() - start;
+}
+
+static uint32_t bench_convert_mult_shift(void) {
+    volatile uint64_t sink;
+    uint32_t start = rdcycle();
+    for (int i = 0; i < ROUNDS; i++) {
+        sink = clock_convert(&tick_to_ns, sample_ticks[i & 7]);
+    }
+    (void)sink;
+    return rdcycle() - start;
+}
+
+// Plain C: 64-bit divide, calls __udivdi3 on RV32. The intermediate
+// ticks * 1e9 also overflows after 2^64 / 1e9 ticks (about 30 minutes).
+static uint32_t bench_convert_divide(void) {
+    volatile uint64_t sink;
+    uint32_t start = rdcycle();
+    for (int i = 0; i < ROUNDS; i++) {
+        sink = sample_ticks[i & 7] * NSEC_PER_SEC / TIMEBASE_HZ;
+    }
+    (void)sink;
+    return rdcycle() - start;
+}
+
+// Compare the conversion against the exact result (exact for 10 MHz)
+static int check_tick_conversion(void) {
+    int errors = 0;
+    for (int i = 0; i < 8; i++) {
+        uint64_t t = sample_ticks[i];
+        uint64_t fast = clock_convert(&tick_to_ns, t);
+        uint64_t exact = t * (NSEC_PER_SEC / TIMEBASE_HZ);
+        if (fast != exact) {
+            printf("  MISMATCH ticks=%llu: %llu != %llu\n", (unsigned long long)t,
+                   (unsigned long long)fast, (unsigned long long)exact);
+            errors++;
+        }
+    }
+    return errors;
+}
+
+// Count how many intermediate compare values leave mip.MTIP raised while
+// moving mtimecmp from the end of this high-word epoch to the next epoch.
+// Interrupts stay disabled, the pending bit is sampled after every store.
+static uint32_t count_mtip_glitches(int safe) {
+    volatile uint32_t *cmp = (volatile uint32_t *)MTIMECMP_ADDR(0);
+    uint32_t glitches = 0;
+
+    for (int i = 0; i < TRIALS; i++) {
+        uint32_t hi = (uint32_t)(mtime_read() >> 32);
+        uint64_t target = (uint64_t)(hi + 1) << 32;
+
+        // Old value: still in the future, MTIP clear
+        mtimecmp_write(0, ((uint64_t)hi << 32) | 0xFFFFFFFFu);
+
+        if (safe) {
+            cmp[0] = 0xFFFFFFFFu;
+            glitches += (read_csr(mip) & MIP_MTIP) != 0;
+            cmp[1] = (uint32_t)(target >> 32);
+            glitches += (read_csr(mip) & MIP_MTIP) != 0;
+            cmp[0] = (uint32_t)target;
+        } else {
+            // Low then high, like "*mtimecmp = value" on RV32
+            cmp[0] = (uint32_t)target;
+            glitches += (read_csr(mip) & MIP_MTIP) != 0;
+            cmp[1] = (uint32_t)(target >> 32);
+        }
+    }
+
+    mtimecmp_write(0, UINT64_MAX);
+    return glitches;
+}
+
+// Two clocks of the same counter must never go backwards, either alone or
+// when interleaved
+static uint32_t check_monotonic(void) {
+    uint32_t backwards = 0;
+    uint64_t last = mtime_read();
+
+    for (int i = 0; i < MONO_READS; i++) {
+        uint64_t now = (i & 1) ? rdtime64() : mtime_read();
+        if (now < last) {
+            backwards++;
+        }
+        last = now;
+    }
+    return backwards;
+}
+
+int main(void) {
+    int failures = 0;
+
+    printf("=== Task 23: 64-bit Clocksource on RV32 ===\n");
+
+    clock_conv_init(&tick_to_ns, TIMEBASE_HZ, NSEC_PER_SEC);
+    uint32_t cpu_hz = clock_calibrate_cpu_hz(TIMEBASE_HZ / 100);   // 10 ms
+    clock_conv_init(&cycle_to_ns, cpu_hz, NSEC_PER_SEC);
+
+    printf("Timebase: %lu Hz, ticks->ns mult %lu shift %lu\n",
+           (unsigned long)TIMEBASE_HZ, (unsigned long)tick_to_ns.mult,
+           (unsigned long)tick_to_ns.shift);
+    printf("CPU:      %lu Hz (rdcycle vs mtime), cycles->ns mult %lu shift %lu\n\n",
+           (unsigned long)cpu_hz, (unsigned long)cycle_to_ns.mult,
+           (unsigned long)cycle_to_ns.shift);
+
+    printf("Read cost:\n");
+    report("*(volatile uint64_t *)mtime", bench_naive_read());
+    report("mtime_read() hi/lo/hi", bench_mtime_read());
+    report("mtime_read_lo()", bench_mtime_read_lo());
+    report("rdtime64() CSR", bench_rdtime64());
+
+    printf("\nConvert cost (ticks -> ns):\n");
+    report("mult/shift", bench_convert_mult_shift());
+    report("64-bit divide (__udivdi3)", bench_convert_divide());
+
+    uint64_t t0 = mtime_read();
+    uint32_t c0 = rdcycle();
+    for (volatile int i = 0; i < 10000; i++) {
+    }
+    uint32_t c1 = rdcycle();
+    uint64_t t1 = mtime_read();
+    printf("\nSample: 10000-iteration loop = %llu ns by mtime, %llu ns by rdcycle\n",
+           (unsigned long long)clock_convert(&tick_to_ns, t1 - t0),
+           (unsigned long long)clock_convert(&cycle_to_ns, c1 - c0));
+
+    printf("\nCorrectness:\n");
+    int conv_errors = check_tick_conversion();
+    printf("  tick conversion mismatches:   %d\n", conv_errors);
+    failures += conv_errors;
+
+    uint32_t naive = count_mtip_glitches(0);
+    uint32_t safe = count_mtip_glitches(1);
+    printf("  MTIP glitches, naive update:  %lu / %d\n", (unsigned long)naive, TRIALS);
+    printf("  MTIP glitches, safe update:   %lu / %d\n", (unsigned long)safe, TRIALS);
+    failures += (safe != 0);
+
+    uint32_t backwards = check_monotonic();
+    printf("  backwards steps in %d reads: %lu\n", MONO_READS, (unsigned long)backwards);
+    failures += (backwards != 0);
+
+    printf("\n%s\n", failures ? "FAILED" : "All checks passed");
+    return failures;
+}
@@ -0,0 +1,170 @@
+#include <stdio.h>
+#include <stdint.h>
+#include "riscv_csr.h"
+#include "plic.h"
+#include "irq_nest.h"
+
+#define TRIALS              50
+#define LOW_WORK_CYCLES     20000   // Length of the slow low-priority handler
+#define TRIGGER_AT_CYCLES   2000    // When the high-priority event arrives
+
+#define LOW_PRIORITY        1
+#define HIGH_PRIORITY       PLIC_MAX_PRIORITY
+
+// 16550 UART: the "transmitter empty" interrupt fires as soon as it is
+// enabled, which makes it a software-triggerable PLIC source
+#define UART_IER            (*(volatile uint8_t *)0x10000001)
+#define UART_IER_THRE       0x02
+
+// Goldfish RTC: an alarm in the past fires immediately
+#define RTC_BASE            0x00101000
+#define RTC_ALARM_LOW       (*(volatile uint32_t *)(RTC_BASE + 0x08))
+#define RTC_ALARM_HIGH      (*(volatile uint32_t *)(RTC_BASE + 0x0C))
+#define RTC_IRQ_ENABLED     (*(volatile uint32_t *)(RTC_BASE + 0x10))
+#define RTC_CLEAR_INTERRUPT (*(volatile uint32_t *)(RTC_BASE + 0x1C))
+
+typedef struct {
+    uint32_t min;
+    uint32_t max;
+    uint32_t sum;
+    uint32_t count;
+} latency_t;
+
+static volatile uint32_t trigger_cycle;
+static volatile int high_done;
+static volatile int low_done;
+static volatile int trigger_from_low;
+static latency_t high_latency;
+static latency_t low_duration;
+
+// Fatal trap information (inspect with GDB)
+volatile uint32_t fatal_mcause = 0;
+volatile uint32_t fatal_mepc = 0;
+
+static void latency_reset(latency_t *l) {
+    l->min = UINT32_MAX;
+    l->max = 0;
+    l->sum = 0;
+    l->count = 0;
+}
+
+static void latency_add(latency_t *l, uint32_t v) {
+    if (v < l->min) l->min = v;
+    if (v > l->max) l->max = v;
+    l->sum += v;
+    l->count++;
+}
+
+static void rtc_fire(void) {
+    trigger_cycle = rdcycle();
+    RTC_ALARM_HIGH = 0;
+    RTC_ALARM_LOW = 0;      // Writing the low word arms the alarm
+}
+
+// High priority: short, measures how long the event waited
+static void high_isr(uint32_t irq) {
+    uint32_t now = rdcycle();
+    (void)irq;
+    RTC_CLEAR_INTERRUPT = 1;
+    latency_add(&high_latency, now - trigger_cycle);
+    high_done = 1;
+}
+
+// Low priority: long-running, the high-priority event arrives part way in
+static void low_isr(uint32_t irq) {
+    uint32_t start = rdcycle();
+    (void)irq;
+    UART_IER = 0;           // Deassert the THRE source
+
+    while (rdcycle() - start < TRIGGER_AT_CYCLES) {
+    }
+    if (trigger_from_low) {
+        rtc_fire();
+    }
+    while (rdcycle() - start < LOW_WORK_CYCLES) {
+    }
+
+    latency_add(&low_duration, rdcycle() - start);
+    low_done = 1;
+}
+
+void trap_dispatch(uint32_t mcause, uint32_t mepc, uint32_t mtval) {
+    if (mcause == (MCAUSE_INTERRUPT | IRQ_M_EXT)) {
+        irq_external_dispatch();
+        return;
+    }
+
+    // Unexpected trap: park the hart (inspect with GDB)
+    (void)mtval;
+    fatal_mcause = mcause;
+    fatal_mepc = mepc;
+    while (1) {
+        asm volatile ("wfi");
+    }
+}
+
+static void run_trials(int nesting, int with_low) {
+    irq_set_nesting(nesting);
+    trigger_from_low = with_low;
+    latency_reset(&high_latency);
+    latency_reset(&low_duration);
+    irq_reset_stats();
+
+    for (int i = 0; i < TRIALS; i++) {
+        high_done = 0;
+        low_done = 0;
+        if (with_low) {
+            UART_IER = UART_IER_THRE;
+            while (!high_done || !low_done) {
+            }
+        } else {
+            rtc_fire();
+            while (!high_done) {
+            }
+        }
+    }
+}
+
+static void report(const char *name, int with_low) {
+    irq_stats_t st;
+    irq_get_stats(&st);
+
+    printf("  %-22s high latency min %6lu avg %6lu max %6lu",
+           name, (unsigned long)high_latency.min,
+           (unsigned long)(high_latency.sum / high_latency.count),
+           (unsigned long)high_latency.max);
+    if (with_low) {
+        printf("  low ISR max %6lu", (unsigned long)low_duration.max);
+    }
+    printf("  nested %lu/%lu depth %lu\n", (unsigned long)st.nested,
+           (unsigned long)st.taken, (unsigned long)st.max_depth);
+}
+
+int main(void) {
+    printf("=== Task 24: Nested Priority-Preemptive Interrupts ===\n");
+    printf("Low:  UART THRE (source %d, priority %d), %d-cycle handler\n",
+           UART0_IRQ, LOW_PRIORITY, LOW_WORK_CYCLES);
+    printf("High: RTC alarm (source %d, priority %d), fired %d cycles into it\n",
+           RTC_IRQ, HIGH_PRIORITY, TRIGGER_AT_CYCLES);
+    printf("Trials: %d, all figures in cycles\n\n", TRIALS);
+
+    irq_register(UART0_IRQ, LOW_PRIORITY, low_isr);
+    irq_register(RTC_IRQ, HIGH_PRIORITY, high_isr);
+    RTC_IRQ_ENABLED = 1;
+    irq_enable_external();
+
+    run_trials(0, 0);
+    report("idle (baseline)", 0);
+
+    run_trials(0, 1);
+    report("busy, nesting off", 1);
+    uint32_t worst_off = high_latency.max;
+
+    run_trials(1, 1);
+    report("busy, nesting on", 1);
+    uint32_t worst_on = high_latency.max;
+
+    printf("\nWorst-case high-priority latency: %lu -> %lu cycles\n",
+           (unsigned long)worst_off, (unsigned long)worst_on);
+    return 0;
+}
@@ -0,0 +1,240 @@
+#include <stdio.h>
+#include <stdint.h>
+#include "riscv_csr.h"
+#include "clocksource.h"
+#include "workq.h"
+
+#define SAMPLES         50
+#define PERIOD_TICKS    (TIMEBASE_HZ / 1000)    // 1 ms sample rate
+#define DATA_SIZE       2048                    // Bytes processed per sample
+#define BURST_EVERY     5                       // Every 5th sample also queues
+                                                // a NORMAL and a HIGH item
+
+typedef enum {
+    MODE_INLINE,        // All processing inside the timer ISR
+    MODE_DEFERRED,      // ISR queues the processing, main loop runs it
+} work_mode_t;
+
+typedef struct {
+    uint32_t max;
+    uint32_t sum;
+    uint32_t count;
+} stat_t;
+
+static work_mode_t mode;
+static uint64_t next_deadline;
+static uint64_t deadlines[SAMPLES];
+static volatile uint32_t samples_taken;
+static volatile uint32_t samples_done;
+static volatile uint32_t urgent_trigger;
+static uint8_t data[DATA_SIZE];
+static volatile uint32_t checksum;
+
+static stat_t isr_cycles;       // Time spent with interrupts disabled
+static stat_t event_ticks;      // Timer deadline -> sample fully processed
+static stat_t urgent_cycles;    // MSIP raised -> MSIP handler entered
+
+// Position (1-based) at which each deferred item ran, per sample and priority
+static uint32_t run_count;
+static uint16_t run_pos[SAMPLES][WORKQ_PRIORITIES];
+
+static clock_conv_t tick_to_ns;
+
+// Fatal trap information (inspect with GDB)
+volatile uint32_t fatal_mcause = 0;
+volatile uint32_t fatal_mepc = 0;
+
+static void stat_reset(stat_t *s) {
+    s->max = 0;
+    s->sum = 0;
+    s->count = 0;
+}
+
+static void stat_add(stat_t *s, uint32_t v) {
+    if (v > s->max) s->max = v;
+    s->sum += v;
+    s->count++;
+}
+
+static uint32_t stat_avg(const stat_t *s) {
+    return s->count ? s->sum / s->count : 0;
+}
+
+// The "real" work for one sample: a checksum pass over a data block.
+// Halfway through, an unrelated urgent event (software interrupt) arrives.
+static void process_sample(uint32_t seq) {
+    uint32_t sum = seq;
+
+    for (int i = 0; i < DATA_SIZE; i++) {
+        sum = (sum << 1 | sum >> 31) ^ data[i];
+        if (i == DATA_SIZE / 2) {
+            urgent_trigger = rdcycle();
+            reg_write(clint_msip0, (msip, 1));
+        }
+    }
+    checksum = sum;
+    run_pos[seq][WORKQ_PRIO_LOW] = (uint16_t)++run_count;
+
+    stat_add(&event_ticks, (uint32_t)(mtime_read() - deadlines[seq]));
+    samples_done++;
+}
+
+// Short follow-up items queued next to a sample; they only log their turn
+static void control_update(uint32_t seq) {
+    run_pos[seq][WORKQ_PRIO_HIGH] = (uint16_t)++run_count;
+}
+
+static void housekeeping(uint32_t seq) {
+    run_pos[seq][WORKQ_PRIO_NORMAL] = (uint16_t)++run_count;
+}
+
+static void timer_isr(void) {
+    uint32_t start = rdcycle();
+    uint32_t seq = samples_taken;
+
+    deadlines[seq] = next_deadline;
+    if (seq + 1 < SAMPLES) {
+        next_deadline += PERIOD_TICKS;
+        mtimecmp_write(0, next_deadline);
+    } else {
+        mtimecmp_write(0, UINT64_MAX);
+    }
+    samples_taken = seq + 1;
+
+    if (mode == MODE_INLINE) {
+        process_sample(seq);
+    } else {
+        workq_enqueue(WORKQ_PRIO_LOW, process_sample, seq);
+        if (seq % BURST_EVERY == 0) {
+            // Queued after the sample, lowest first: priority must reorder them
+            workq_enqueue(WORKQ_PRIO_NORMAL, housekeeping, seq);
+            workq_enqueue(WORKQ_PRIO_HIGH, control_update, seq);
+        }
+    }
+
+    stat_add(&isr_cycles, rdcycle() - start);
+}
+
+static void soft_isr(void) {
+    uint32_t now = rdcycle();
+    reg_write(clint_msip0, (msip, 0));
+    stat_add(&urgent_cycles, now - urgent_trigger);
+}
+
+void trap_dispatch(uint32_t mcause, uint32_t mepc, uint32_t mtval) {
+    if (mcause == (MCAUSE_INTERRUPT | IRQ_M_TIMER)) {
+        timer_isr();
+        return;
+    }
+    if (mcause == (MCAUSE_INTERRUPT | IRQ_M_SOFT)) {
+        soft_isr();
+        return;
+    }
+
+    // Unexpected trap: park the hart (inspect with GDB)
+    (void)mtval;
+    fatal_mcause = mcause;
+    fatal_mepc = mepc;
+    while (1) {
+        asm volatile ("wfi");
+    }
+}
+
+static void run(work_mode_t m) {
+    mode = m;
+    samples_taken = 0;
+    samples_done = 0;
+    stat_reset(&isr_cycles);
+    stat_reset(&event_ticks);
+    stat_reset(&urgent_cycles);
+    run_count = 0;
+    for (int i = 0; i < SAMPLES; i++) {
+        for (int p = 0; p < WORKQ_PRIORITIES; p++) {
+            run_pos[i][p] = 0;
+        }
+    }
+
+    next_deadline = mtime_read() + PERIOD_TICKS;
+    mtimecmp_write(0, next_deadline);
+    set_csr(mie, MIP_MTIP | MIP_MSIP);
+    set_csr(mstatus, MSTATUS_MIE);
+
+    while (samples_done < SAMPLES) {
+        if (mode == MODE_DEFERRED) {
+            workq_run();
+        }
+
+        // Sleep unless work arrived since the check (see TASK20)
+        clear_csr(mstatus, MSTATUS_MIE);
+        if (workq_pending() == 0 && samples_done < SAMPLES) {
+            asm volatile ("wfi");
+        }
+        set_csr(mstatus, MSTATUS_MIE);
+    }
+
+    clear_csr(mstatus, MSTATUS_MIE);
+    clear_csr(mie, MIP_MTIP | MIP_MSIP);
+}
+
+static void report(const char *name) {
+    printf("%s:\n", name);
+    printf("  interrupts-off per timer ISR   avg %6lu  max %6lu cycles\n",
+           (unsigned long)stat_avg(&isr_cycles), (unsigned long)isr_cycles.max);
+    printf("  urgent event (MSIP) latency    avg %6lu  max %6lu cycles\n",
+           (unsigned long)stat_avg(&urgent_cycles), (unsigned long)urgent_cycles.max);
+    printf("  sample deadline -> processed   avg %6lu  max %6lu ns\n",
+           (unsigned long)clock_convert(&tick_to_ns, stat_avg(&event_ticks)),
+           (unsigned long)clock_convert(&tick_to_ns, event_ticks.max));
+}
+
+// Each burst was queued LOW, NORMAL, HIGH in one ISR, so all three were
+// pending together: the dispatcher must have run them HIGH, NORMAL, LOW
+static uint32_t check_priority_order(void) {
+    uint32_t bursts = 0, ordered = 0;
+
+    for (int i = 0; i < SAMPLES; i += BURST_EVERY) {
+        uint16_t *pos = run_pos[i];
+        bursts++;
+        if (pos[WORKQ_PRIO_HIGH] && pos[WORKQ_PRIO_HIGH] < pos[WORKQ_PRIO_NORMAL] &&
+            pos[WORKQ_PRIO_NORMAL] < pos[WORKQ_PRIO_LOW]) {
+            ordered++;
+        }
+    }
+
+    uint16_t *first = run_pos[0];
+    printf("\nPriority dispatch: %lu bursts queued LOW, NORMAL, HIGH\n",
+           (unsigned long)bursts);
+    printf("  first burst ran at positions HIGH %u, NORMAL %u, LOW %u\n",
+           first[WORKQ_PRIO_HIGH], first[WORKQ_PRIO_NORMAL], first[WORKQ_PRIO_LOW]);
+    printf("  %lu of %lu drained highest priority first: %s\n",
+           (unsigned long)ordered, (unsigned long)bursts,
+           ordered == bursts ? "PASS" : "FAIL");
+    return bursts - ordered;
+}
+
+int main(void) {
+    for (int i = 0; i < DATA_SIZE; i++) {
+        data[i] = (uint8_t)(i * 7 + 3);
+    }
+    clock_conv_init(&tick_to_ns, TIMEBASE_HZ, NSEC_PER_SEC);
+    workq_init();
+
+    printf("=== Task 25: Deferred Work Queue ===\n");
+    printf("%d samples at 1 kHz, %d bytes processed per sample\n\n",
+           SAMPLES, DATA_SIZE);
+
+    run(MODE_INLINE);
+    report("Inline (work in the timer ISR)");
+
+    run(MODE_DEFERRED);
+    report("Deferred (ISR queues, main loop runs)");
+    uint32_t failures = check_priority_order();
+
+    workq_stats_t ws;
+    workq_get_stats(&ws);
+    printf("\nWork queue: %lu queued, %lu run, %lu dropped, max %lu pending\n",
+           (unsigned long)ws.enqueued, (unsigned long)ws.executed,
+           (unsigned long)ws.dropped, (unsigned long)ws.max_pending);
+    printf("Checksum: 0x%08lx\n", (unsigned long)checksum);
+    return (int)failures;
+}
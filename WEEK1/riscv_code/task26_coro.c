@@ -0,0 +1,257 @@
+#include <stdint.h>
+#include "riscv_csr.h"
+#include "clocksource.h"
+#include "gpio_hal.h"
+#include "sifive_uart.h"
+#include "context_switch.h"
+#include "coro.h"
+
+// 16K of SRAM on the FE310: no heap, no printf, small stacks
+#define MS(n)           ((uint32_t)(n) * (TIMEBASE_HZ / 1000))
+#define RUN_TIME        MS(2000)
+#define PULSE_PIN       9           // Driven and watched: output loops back
+#define SWITCH_ROUNDS   1000
+
+#define THREAD_STACK    512         // Smallest sane stack for a C thread
+
+// Application tasks: each keeps its live state in its own struct
+typedef struct {
+    coro_t co;
+    uint32_t pin;
+    uint32_t period;
+    uint32_t toggles;
+} blinker_t;
+
+typedef struct {
+    coro_t co;
+    uint32_t pulses;
+} pulser_t;
+
+typedef struct {
+    coro_t co;
+    uint32_t edges;
+} watcher_t;
+
+typedef struct {
+    coro_t co;
+    uint8_t ch;
+    uint32_t bytes;
+} console_t;
+
+typedef struct {
+    coro_t co;
+} supervisor_t;
+
+typedef struct {
+    coro_t co;
+    uint32_t count;
+} pinger_t;
+
+static blinker_t red, green;
+static pulser_t pulser;
+static watcher_t watcher;
+static console_t console;
+static supervisor_t supervisor;
+static pinger_t ping, pong;
+
+// Threaded baseline: one thread with its own stack
+static uint32_t thread_stack[THREAD_STACK / 4] __attribute__((aligned(16)));
+static uint32_t main_sp;
+static uint32_t thread_sp;
+
+static void put_line(const char *name, uint32_t v, const char *unit) {
+    put_str(name);
+    put_dec(v, 0);
+    put_str(unit);
+    put_str("\n");
+}
+
+// ---- Coroutines ------------------------------------------------------------
+
+static int blink(coro_t *c) {
+    blinker_t *b = (blinker_t *)c;
+    CORO_BEGIN(c);
+    GPIO_SET_BIT(GPIO_OUTPUT_EN, b->pin);
+    for (;;) {
+        GPIO_TOGGLE_BIT(GPIO_OUTPUT_VAL, b->pin);
+        b->toggles++;
+        await_ticks(c, b->period);
+    }
+    CORO_END(c);
+}
+
+static int pulse(coro_t *c) {
+    pulser_t *p = (pulser_t *)c;
+    CORO_BEGIN(c);
+    GPIO_CLEAR_BIT(GPIO_OUTPUT_VAL, PULSE_PIN);
+    GPIO_SET_BIT(GPIO_OUTPUT_EN, PULSE_PIN);
+    for (;;) {
+        await_ticks(c, MS(30));
+        GPIO_SET_BIT(GPIO_OUTPUT_VAL, PULSE_PIN);
+        p->pulses++;
+        await_ticks(c, MS(20));
+        GPIO_CLEAR_BIT(GPIO_OUTPUT_VAL, PULSE_PIN);
+    }
+    CORO_END(c);
+}
+
+static int watch(coro_t *c) {
+    watcher_t *w = (watcher_t *)c;
+    CORO_BEGIN(c);
+    GPIO_SET_BIT(GPIO_OUTPUT_EN, LED_PIN_BLUE);
+    for (;;) {
+        await_gpio_edge(c, PULSE_PIN, CORO_EDGE_RISE);
+        GPIO_TOGGLE_BIT(GPIO_OUTPUT_VAL, LED_PIN_BLUE);
+        w->edges++;
+    }
+    CORO_END(c);
+}
+
+static int echo(coro_t *c) {
+    console_t *k = (console_t *)c;
+    CORO_BEGIN(c);
+    for (;;) {
+        await_uart_rx(c, &k->ch);
+        k->bytes++;
+        if (k->ch == 'q') {
+            coro_stop();
+        }
+        sifive_uart_putc((char)k->ch);
+    }
+    CORO_END(c);
+}
+
+static int supervise(coro_t *c) {
+    CORO_BEGIN(c);
+    await_ticks(c, RUN_TIME);
+    coro_stop();
+    CORO_END(c);
+}
+
+// Yield back and forth through the event loop
+static int ping_pong(coro_t *c) {
+    pinger_t *p = (pinger_t *)c;
+    CORO_BEGIN(c);
+    while (p->count < SWITCH_ROUNDS) {
+        p->count++;
+        CORO_YIELD(c);
+    }
+    CORO_END(c);
+}
+
+// ---- Threaded baseline -----------------------------------------------------
+
+static void thread_body(void) {
+    for (;;) {
+        context_switch(&thread_sp, main_sp);
+    }
+}
+
+static void thread_init(void) {
+    uint32_t top = ((uint32_t)(thread_stack + THREAD_STACK / 4)) & ~15u;
+    uint32_t *frame = (uint32_t *)(top - CONTEXT_FRAME_SIZE);
+
+    for (int i = 0; i < CONTEXT_FRAME_SIZE / 4; i++) {
+        frame[i] = 0;
+    }
+    frame[0] = (uint32_t)thread_bootstrap;  // ra
+    frame[1] = (uint32_t)thread_body;       // s0
+    thread_sp = (uint32_t)frame;
+}
+
+// Cycles for one round trip main -> thread -> main
+static uint32_t bench_thread_switch(void) {
+    thread_init();
+    uint32_t start = rdcycle();
+    for (int i = 0; i < SWITCH_ROUNDS; i++) {
+        context_switch(&main_sp, thread_sp);
+    }
+    return (rdcycle() - start) / SWITCH_ROUNDS;
+}
+
+// Cycles for one resume + wait of a coroutine called directly
+static uint32_t bench_coro_resume(void) {
+    pinger_t p = { 0 };
+    p.co.fn = ping_pong;
+    uint32_t start = rdcycle();
+    for (int i = 0; i < SWITCH_ROUNDS; i++) {
+        ping_pong(&p.co);
+    }
+    return (rdcycle() - start) / SWITCH_ROUNDS;
+}
+
+// Cycles per resume when two coroutines yield to each other via coro_run
+static uint32_t bench_coro_loop(void) {
+    coro_stats_t st;
+    coro_reset();
+    ping.count = 0;
+    pong.count = 0;
+    coro_spawn(&ping.co, ping_pong);
+    coro_spawn(&pong.co, ping_pong);
+
+    uint32_t start = rdcycle();
+    coro_run();
+    uint32_t cycles = rdcycle() - start;
+
+    coro_get_stats(&st);
+    return cycles / st.resumes;
+}
+
+// ---- Main ------------------------------------------------------------------
+
+int main(void) {
+    coro_stats_t st;
+
+    coro_init();
+    put_str("=== Task 26: Stackless Coroutines ===\n");
+    put_str("Type on the console (q quits), running for 2 s...\n");
+
+    red.pin = LED_PIN_RED;
+    red.period = MS(100);
+    green.pin = LED_PIN_GREEN;
+    green.period = MS(150);
+
+    coro_spawn(&red.co, blink);
+    coro_spawn(&green.co, blink);
+    coro_spawn(&pulser.co, pulse);
+    coro_spawn(&watcher.co, watch);
+    coro_spawn(&console.co, echo);
+    coro_spawn(&supervisor.co, supervise);
+
+    uint64_t t0 = mtime_read();
+    coro_run();
+    uint64_t t1 = mtime_read();
+    coro_get_stats(&st);
+
+    put_str("\n\nTasks:\n");
+    put_line("  red toggles      ", red.toggles, "");
+    put_line("  green toggles    ", green.toggles, "");
+    put_line("  pulses driven    ", pulser.pulses, "");
+    put_line("  edges seen       ", watcher.edges, "");
+    put_line("  console bytes    ", console.bytes, "");
+
+    put_str("\nEvent loop:\n");
+    put_line("  run time         ", (uint32_t)(t1 - t0) / (TIMEBASE_HZ / 1000), " ms");
+    put_line("  resumes          ", st.resumes, "");
+    put_line("  loop iterations  ", st.loops, "");
+    put_line("  wfi sleeps       ", st.sleeps, "");
+    put_line("  interrupts       ", st.irqs, "");
+
+    uint32_t coro_ram = sizeof(red) + sizeof(green) + sizeof(pulser) +
+                        sizeof(watcher) + sizeof(console) + sizeof(supervisor);
+    uint32_t thread_ram = 6 * (THREAD_STACK + sizeof(uint32_t));
+
+    put_str("\nRAM per task:\n");
+    put_line("  coro_t               ", sizeof(coro_t), " bytes");
+    put_line("  blinker_t            ", sizeof(blinker_t), " bytes");
+    put_line("  console_t            ", sizeof(console_t), " bytes");
+    put_line("  6 coroutines total   ", coro_ram, " bytes");
+    put_line("  6 threads (stack+sp) ", thread_ram, " bytes");
+
+    put_str("\nSwitch cost (cycles):\n");
+    put_line("  thread round trip (context_switch x2) ", bench_thread_switch(), "");
+    put_line("  coroutine resume + wait, direct call  ", bench_coro_resume(), "");
+    put_line("  coroutine resume via the event loop   ", bench_coro_loop(), "");
+
+    return 0;
+}
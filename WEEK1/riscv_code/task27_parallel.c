@@ -0,0 +1,170 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "clocksource.h"
+#include "parallel.h"
+#include "stack.h"
+
+#define BUF_WORDS       (1u << 20)      // 4 MB
+#define BUF_GRAIN       4096            // Words per leaf range
+#define MAT_N           96
+#define MAT_GRAIN       2               // Rows per leaf range
+#define REPEATS         3               // Best of
+#define FILL_BYTE       0x5A
+
+typedef struct {
+    const char *name;
+    uint32_t (*run)(void);              // Returns a result to cross-check
+} kernel_t;
+
+static uint32_t buf[BUF_WORDS];
+static int32_t mat_a[MAT_N][MAT_N];
+static int32_t mat_b[MAT_N][MAT_N];
+static int32_t mat_c[MAT_N][MAT_N];
+
+static clock_conv_t tick_to_us;
+
+// ---- Kernels -----------------------------------------------------------------
+
+static void memset_range(void *ctx, uint32_t lo, uint32_t hi) {
+    (void)ctx;
+    memset(&buf[lo], FILL_BYTE, (hi - lo) * sizeof(uint32_t));
+}
+
+static uint32_t checksum_range(void *ctx, uint32_t lo, uint32_t hi) {
+    uint32_t sum = 0;
+    (void)ctx;
+    for (uint32_t i = lo; i < hi; i++) {
+        sum += buf[i] ^ i;
+    }
+    return sum;
+}
+
+static uint32_t add_u32(uint32_t a, uint32_t b) {
+    return a + b;
+}
+
+static void matmul_rows(void *ctx, uint32_t lo, uint32_t hi) {
+    (void)ctx;
+    for (uint32_t i = lo; i < hi; i++) {
+        for (uint32_t j = 0; j < MAT_N; j++) {
+            int32_t acc = 0;
+            for (uint32_t k = 0; k < MAT_N; k++) {
+                acc += mat_a[i][k] * mat_b[k][j];
+            }
+            mat_c[i][j] = acc;
+        }
+    }
+}
+
+static uint32_t run_memset(void) {
+    parallel_for(0, BUF_WORDS, BUF_GRAIN, memset_range, 0);
+    return buf[BUF_WORDS - 1];
+}
+
+static uint32_t run_checksum(void) {
+    return parallel_reduce(0, BUF_WORDS, BUF_GRAIN, checksum_range, add_u32, 0, 0);
+}
+
+static uint32_t run_matmul(void) {
+    parallel_for(0, MAT_N, MAT_GRAIN, matmul_rows, 0);
+    return (uint32_t)mat_c[MAT_N - 1][MAT_N - 1] ^ (uint32_t)mat_c[0][0];
+}
+
+static const kernel_t kernels[] = {
+    { "memset 4 MB",   run_memset },
+    { "checksum 4 MB", run_checksum },     // Of the buffer memset filled
+    { "matmul 96x96",  run_matmul },
+};
+#define NUM_KERNELS (sizeof(kernels) / sizeof(kernels[0]))
+
+// ---- Measurement ---------------------------------------------------------------
+
+static uint32_t steals_total(uint32_t workers) {
+    uint32_t steals = 0;
+    for (uint32_t h = 0; h < workers; h++) {
+        par_stats_t st;
+        parallel_get_stats(h, &st);
+        steals += st.steals;
+    }
+    return steals;
+}
+
+static uint64_t time_kernel(const kernel_t *k, uint32_t *result) {
+    uint64_t best = UINT64_MAX;
+    for (int r = 0; r < REPEATS; r++) {
+        uint64_t start = mtime_read();
+        *result = k->run();
+        uint64_t ticks = mtime_read() - start;
+        if (ticks < best) {
+            best = ticks;
+        }
+    }
+    return best;
+}
+
+int main(void) {
+    uint64_t base[NUM_KERNELS];
+    uint32_t expect[NUM_KERNELS];
+    int mismatches = 0;
+
+    clock_conv_init(&tick_to_us, TIMEBASE_HZ, 1000000);
+    uint32_t harts = parallel_init();
+
+    for (int i = 0; i < MAT_N; i++) {
+        for (int j = 0; j < MAT_N; j++) {
+            mat_a[i][j] = i + j;
+            mat_b[i][j] = i - j;
+        }
+    }
+
+    printf("=== Task 27: Work-Stealing parallel_for ===\n");
+    printf("Harts online: %lu\n\n", (unsigned long)harts);
+    printf("%-14s %7s %10s %8s %8s\n", "kernel", "workers", "time(us)", "speedup", "steals");
+
+    for (uint32_t k = 0; k < NUM_KERNELS; k++) {
+        for (uint32_t w = 1; w <= harts; w++) {
+            uint32_t result;
+
+            parallel_set_workers(w);
+            parallel_reset_stats();
+            uint64_t ticks = time_kernel(&kernels[k], &result);
+            uint32_t steals = steals_total(w);
+
+            if (w == 1) {
+                base[k] = ticks;
+                expect[k] = result;
+            } else if (result != expect[k]) {
+                mismatches++;
+            }
+
+            // Speedup in hundredths, 32-bit math (times are well under 2^32 ticks)
+            uint32_t speedup = ticks ? (uint32_t)base[k] * 100 / (uint32_t)ticks : 0;
+            printf("%-14s %7lu %10lu %5lu.%02lu %8lu\n", kernels[k].name,
+                   (unsigned long)w,
+                   (unsigned long)clock_convert(&tick_to_us, ticks),
+                   (unsigned long)(speedup / 100), (unsigned long)(speedup % 100),
+                   (unsigned long)(steals / REPEATS));
+        }
+    }
+
+    printf("\nPer-hart totals for the last run (%lu workers):\n", (unsigned long)harts);
+    for (uint32_t h = 0; h < harts; h++) {
+        par_stats_t st;
+        parallel_get_stats(h, &st);
+        printf("  hart %lu: %6lu ranges %6lu splits %6lu steals %8lu failed steals\n",
+               (unsigned long)h, (unsigned long)st.ranges, (unsigned long)st.splits,
+               (unsigned long)st.steals, (unsigned long)st.steal_fails);
+    }
+
+    printf("\nStacks (painted at boot):\n");
+    for (uint32_t i = 0; i < stack_count(); i++) {
+        const stack_region_t *s = stack_get(i);
+        printf("  %-6s %6lu bytes, %6lu used, canary %s\n", s->name,
+               (unsigned long)stack_size(s), (unsigned long)stack_high_water(s),
+               stack_canary_ok(s) ? "ok" : "BROKEN");
+    }
+
+    printf("\nResults %s across worker counts\n", mismatches ? "DIFFER" : "match");
+    return 0;
+}
@@ -0,0 +1,177 @@
+#include <stdint.h>
+#include "riscv_csr.h"
+#include "clocksource.h"
+#include "sifive_uart.h"
+#include "context_switch.h"
+#include "stack.h"
+
+#define TICK_PERIOD     (TIMEBASE_HZ / 1000)    // 1 kHz
+#define TICKS_TO_RUN    50
+#define THREAD_STACK    1024
+#define RECURSE_DEPTH   6
+#define MARGIN          64                      // Headroom when suggesting a size
+
+#define EXC_LOAD_ACCESS     5
+#define EXC_STORE_ACCESS    7
+
+static uint32_t thread_stack[THREAD_STACK / 4] __attribute__((aligned(16)));
+static uint32_t main_sp;
+static uint32_t thread_sp;
+
+static volatile uint32_t ticks;
+static volatile uint32_t isr_crc;
+static volatile uint32_t sink;
+
+// ---- Workloads ---------------------------------------------------------------
+
+// Main-stack work: a few nested frames with local buffers
+static uint32_t __attribute__((noinline)) nested(uint32_t depth) {
+    volatile uint8_t scratch[48];
+    for (uint32_t i = 0; i < sizeof(scratch); i++) {
+        scratch[i] = (uint8_t)(depth + i);
+    }
+    return depth ? nested(depth - 1) + scratch[depth] : scratch[0];
+}
+
+// Interrupt-stack work: a CRC over a local block
+static uint32_t __attribute__((noinline)) isr_work(uint32_t seed) {
+    uint8_t block[32];
+    uint32_t crc = 0xFFFFFFFFu;
+    for (uint32_t i = 0; i < sizeof(block); i++) {
+        block[i] = (uint8_t)(seed * 31 + i);
+    }
+    for (uint32_t i = 0; i < sizeof(block); i++) {
+        crc ^= block[i];
+        for (int b = 0; b < 8; b++) {
+            crc = (crc >> 1) ^ (0xEDB88320u & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+// Thread-stack work
+static void thread_body(void) {
+    for (;;) {
+        sink = nested(RECURSE_DEPTH / 2);
+        context_switch(&thread_sp, main_sp);
+    }
+}
+
+// No base case: runs until the main stack guard stops it
+static uint32_t __attribute__((noinline)) overflow(uint32_t n) {
+    volatile uint32_t pad[16];
+    pad[0] = n;
+    return overflow(n + 1) + pad[0];
+}
+
+// ---- Traps -------------------------------------------------------------------
+
+void trap_dispatch(uint32_t mcause, uint32_t mepc, uint32_t mtval) {
+    if (mcause == (MCAUSE_INTERRUPT | IRQ_M_TIMER)) {
+        ticks++;
+        if (ticks < TICKS_TO_RUN) {
+            mtimecmp_write(0, mtime_read() + TICK_PERIOD);
+        } else {
+            mtimecmp_write(0, UINT64_MAX);
+        }
+        isr_crc = isr_work(ticks);
+        return;
+    }
+
+    // Running on the ISR stack, so a main-stack overflow can still report
+    const char *owner = stack_guard_owner(mtval);
+    if ((mcause == EXC_STORE_ACCESS || mcause == EXC_LOAD_ACCESS) && owner) {
+        put_str("\nGuard hit: ");
+        put_str(owner);
+        put_str(" stack overflowed, access at ");
+    } else {
+        put_str("\nUnexpected trap: mcause ");
+        put_dec(mcause, 0);
+        put_str(", mtval ");
+    }
+    put_hex(mtval);
+    put_str(" from pc ");
+    put_hex(mepc);
+    put_str("\n");
+    while (1) {
+        asm volatile ("wfi");
+    }
+}
+
+// ---- Report ------------------------------------------------------------------
+
+static uint32_t round_up(uint32_t v, uint32_t to) {
+    return (v + to - 1) / to * to;
+}
+
+static void report(void) {
+    put_str("stack     size   used   free  canary  suggested\n");
+    for (uint32_t i = 0; i < stack_count(); i++) {
+        const stack_region_t *s = stack_get(i);
+        uint32_t size = stack_size(s);
+        uint32_t used = stack_high_water(s);
+
+        put_pad(s->name, 8);
+        put_dec(size, 6);
+        put_dec(used, 7);
+        put_dec(size - used, 7);
+        put_str(stack_canary_ok(s) ? "      ok" : "  BROKEN");
+        put_dec(round_up(used + MARGIN, 64), 11);
+        put_str("\n");
+    }
+}
+
+int main(void) {
+    sifive_uart_init();
+    put_str("=== Task 28: Stack Usage and Guards ===\n");
+
+    stack_register_boot();
+
+    // Thread stack: painted here, before it is ever switched to
+    uint32_t *t_lo = thread_stack;
+    uint32_t *t_hi = thread_stack + THREAD_STACK / 4;
+    stack_paint(t_lo, t_hi);
+    stack_register("thread", t_lo, t_hi);
+
+    uint32_t top = ((uint32_t)t_hi) & ~15u;
+    uint32_t *frame = (uint32_t *)(top - CONTEXT_FRAME_SIZE);
+    for (int i = 0; i < CONTEXT_FRAME_SIZE / 4; i++) {
+        frame[i] = 0;
+    }
+    frame[0] = (uint32_t)thread_bootstrap;  // ra
+    frame[1] = (uint32_t)thread_body;       // s0
+    thread_sp = (uint32_t)frame;
+
+    put_str("SRAM: data+bss ");
+    put_dec((uint32_t)_stack_guard - 0x80000000u, 0);
+    put_str(" B, free after stacks ");
+    put_dec((uint32_t)_free_end - (uint32_t)_free_start, 0);
+    put_str(" B\n");
+
+    stack_guard_pmp(0, _stack_guard);
+    stack_guard_pmp(1, _isr_stack_guard);
+    put_str("PMP guards: main ");
+    put_hex((uint32_t)_stack_guard);
+    put_str(", isr ");
+    put_hex((uint32_t)_isr_stack_guard);
+    put_str("\n\n");
+
+    // Run everything once: main work, thread work, timer ISRs
+    sink = nested(RECURSE_DEPTH);
+    context_switch(&main_sp, thread_sp);
+
+    mtimecmp_write(0, mtime_read() + TICK_PERIOD);
+    set_csr(mie, MIP_MTIP);
+    set_csr(mstatus, MSTATUS_MIE);
+    while (ticks < TICKS_TO_RUN) {
+        asm volatile ("wfi");
+    }
+    clear_csr(mstatus, MSTATUS_MIE);
+
+    report();
+
+    put_str("\nRecursing without limit on the main stack...");
+    sink = overflow(0);
+    put_str("\nGuard did not fire\n");
+    return 0;
+}
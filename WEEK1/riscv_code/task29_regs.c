@@ -0,0 +1,182 @@
+#include <stdint.h>
+#include "riscv_csr.h"
+#include "gpio_hal.h"
+#include "sifive_uart.h"
+#include "uart_rx.h"
+
+// Raw bit macros vs the typed register layer (reg.h / regmap.h) for the
+// same operations. Each pair is noinline so build_regs_demo.sh can count
+// the instructions of both from the disassembly.
+
+#define ROUNDS  100
+
+// ---- Before: one read-modify-write per bit ------------------------------------
+
+void __attribute__((noinline)) gpio_init_raw(void) {
+    GPIO_SET_BIT(GPIO_OUTPUT_EN, LED_PIN_RED);
+    GPIO_SET_BIT(GPIO_OUTPUT_EN, LED_PIN_GREEN);
+    GPIO_SET_BIT(GPIO_OUTPUT_EN, LED_PIN_BLUE);
+
+    GPIO_SET_BIT(GPIO_OUTPUT_VAL, LED_PIN_RED);
+    GPIO_SET_BIT(GPIO_OUTPUT_VAL, LED_PIN_GREEN);
+    GPIO_SET_BIT(GPIO_OUTPUT_VAL, LED_PIN_BLUE);
+
+    GPIO_CLEAR_BIT(GPIO_IOF_EN, LED_PIN_RED);
+    GPIO_CLEAR_BIT(GPIO_IOF_EN, LED_PIN_GREEN);
+    GPIO_CLEAR_BIT(GPIO_IOF_EN, LED_PIN_BLUE);
+}
+
+void __attribute__((noinline)) uart_init_raw(void) {
+    SIFIVE_UART_REG(SIFIVE_UART_TXCTRL) = SIFIVE_UART_TXEN;
+    SIFIVE_UART_REG(SIFIVE_UART_RXCTRL) = SIFIVE_UART_RXEN;
+}
+
+void __attribute__((noinline)) uart_putc_raw(char c) {
+    while (SIFIVE_UART_REG(SIFIVE_UART_TXDATA) & SIFIVE_UART_FIFO_FLAG) {
+    }
+    SIFIVE_UART_REG(SIFIVE_UART_TXDATA) = (uint8_t)c;
+}
+
+// 16550 path of syscalls.c (QEMU virt): compiled for the listing only
+void __attribute__((noinline, used)) ns16550_putc_raw(char c) {
+    *(volatile uint32_t *)(UART_BASE + 0x00) = (uint32_t)c;
+}
+
+// ---- After: fields combined at compile time ---------------------------------
+
+void __attribute__((noinline)) gpio_init_typed(void) {
+    reg_modify(gpio_output_en, (red, 1), (green, 1), (blue, 1));
+    reg_modify(gpio_output_val, (red, 1), (green, 1), (blue, 1));
+    reg_modify(gpio_iof_en, (red, 0), (green, 0), (blue, 0));
+}
+
+void __attribute__((noinline)) uart_init_typed(void) {
+    sifive_uart_init();
+}
+
+void __attribute__((noinline)) uart_putc_typed(char c) {
+    sifive_uart_putc(c);
+}
+
+void __attribute__((noinline, used)) ns16550_putc_typed(char c) {
+    reg_write(ns16550_thr, (data, c));
+}
+
+// ---- Rejected at compile time (build_regs_demo.sh step 4) --------------------
+
+#if defined(REG_MISUSE_TEST) && REG_MISUSE_TEST == 1
+void misuse(void) { reg_write(sifive_uart_ip, (rxwm, 1)); }        // Read-only register
+#elif defined(REG_MISUSE_TEST) && REG_MISUSE_TEST == 2
+void misuse(void) { reg_write(sifive_uart_txdata, (full, 1)); }    // Read-only field
+#elif defined(REG_MISUSE_TEST) && REG_MISUSE_TEST == 3
+uint32_t misuse(void) { return reg_read(ns16550_thr); }           // Write-only register
+#elif defined(REG_MISUSE_TEST) && REG_MISUSE_TEST == 4
+void misuse(void) { reg_modify(ns16550_fcr, (enable, 1)); }        // RMW of a write-only register
+#elif defined(REG_MISUSE_TEST) && REG_MISUSE_TEST == 5
+void misuse(void) { reg_modify(gpio_output_en, (purple, 1)); }     // No such field
+#elif defined(REG_MISUSE_TEST) && REG_MISUSE_TEST == 6
+void misuse(void) { reg_modify(gpio_rise_ip, (red, 1)); }          // RMW clears all pending
+#elif defined(REG_MISUSE_TEST) && REG_MISUSE_TEST == 7
+void misuse(void) { reg_modify(sifive_uart_txdata, (data, 'x')); } // RMW pushes a byte
+#endif
+
+// ---- Main ------------------------------------------------------------------
+
+typedef struct {
+    uint32_t output_en;
+    uint32_t output_val;
+    uint32_t iof_en;
+} gpio_state_t;
+
+static void gpio_snapshot(gpio_state_t *s) {
+    s->output_en = reg_read(gpio_output_en);
+    s->output_val = reg_read(gpio_output_val);
+    s->iof_en = reg_read(gpio_iof_en);
+}
+
+static void gpio_reset(void) {
+    reg_write(gpio_output_en, (all, 0));
+    reg_write(gpio_output_val, (all, 0));
+    reg_write(gpio_iof_en, (red, 1), (green, 1), (blue, 1));   // Worst case for iof_en
+}
+
+// Average cycles of fn() over ROUNDS, each from the same starting state
+static uint32_t time_gpio_init(void (*fn)(void), gpio_state_t *after) {
+    uint32_t total = 0;
+    for (int i = 0; i < ROUNDS; i++) {
+        gpio_reset();
+        uint32_t start = rdcycle();
+        fn();
+        total += rdcycle() - start;
+    }
+    gpio_snapshot(after);
+    return total / ROUNDS;
+}
+
+static uint32_t time_uart_putc(void (*fn)(char)) {
+    uint32_t start = rdcycle();
+    for (int i = 0; i < ROUNDS; i++) {
+        fn('.');
+    }
+    return (rdcycle() - start) / ROUNDS;
+}
+
+static void put_state(const char *name, const gpio_state_t *s) {
+    put_str(name);
+    put_str(" output_en ");
+    put_hex(s->output_en);
+    put_str("  output_val ");
+    put_hex(s->output_val);
+    put_str("  iof_en ");
+    put_hex(s->iof_en);
+    put_str("\n");
+}
+
+int main(void) {
+    gpio_state_t raw, typed;
+
+    uart_init_raw();
+    uart_init_typed();
+    put_str("=== Task 29: Typed Register Layer ===\n\n");
+
+    uint32_t gpio_raw = time_gpio_init(gpio_init_raw, &raw);
+    uint32_t gpio_typed = time_gpio_init(gpio_init_typed, &typed);
+    put_state("raw  ", &raw);
+    put_state("typed", &typed);
+    int same = raw.output_en == typed.output_en &&
+               raw.output_val == typed.output_val &&
+               raw.iof_en == typed.iof_en;
+    put_str(same ? "GPIO state matches\n\n" : "GPIO state DIFFERS\n\n");
+
+    uint32_t putc_raw = time_uart_putc(uart_putc_raw);
+    uint32_t putc_typed = time_uart_putc(uart_putc_typed);
+
+    put_str("\n\ncycles (avg)        raw  typed\n");
+    put_str("gpio_init()     ");
+    put_dec(gpio_raw, 7);
+    put_dec(gpio_typed, 7);
+    put_str("\nuart putc       ");
+    put_dec(putc_raw, 7);
+    put_dec(putc_typed, 7);
+    put_str("\n\nLED field read back: red ");
+    put_dec(reg_get(gpio_output_val, red), 0);
+    put_str(", green ");
+    put_dec(reg_get(gpio_output_val, green), 0);
+    put_str(", blue ");
+    put_dec(reg_get(gpio_output_val, blue), 0);
+    put_str("\n");
+    return 0;
+}
+
+void trap_dispatch(uint32_t mcause, uint32_t mepc, uint32_t mtval) {
+    put_str("\nUnexpected trap: mcause ");
+    put_dec(mcause, 0);
+    put_str(", mepc ");
+    put_hex(mepc);
+    put_str(", mtval ");
+    put_hex(mtval);
+    put_str("\n");
+    while (1) {
+        asm volatile ("wfi");
+    }
+}
@@ -0,0 +1,173 @@
+#include <stdint.h>
+#include "riscv_csr.h"
+#include "clocksource.h"
+#include "gpio_hal.h"
+#include "sifive_uart.h"
+#include "wave.h"
+
+#define MAX_EDGES       256             // 2 KB of the 16K SRAM
+#define RUNS            20              // Worst case over this many bursts
+#define TICK_PERIOD     (TIMEBASE_HZ / 1000)    // 1 kHz background interrupt
+
+// WS2812 timings (datasheet nominal values)
+#define WS_T0H_NS       400
+#define WS_T1H_NS       800
+#define WS_PERIOD_NS    1250
+#define WS_RESET_NS     50000
+
+#define UART_BAUD       115200
+#define SPI_HZ          1000000
+
+typedef enum {
+    PROTO_WS2812,
+    PROTO_UART,
+    PROTO_SPI,
+} proto_t;
+
+static wave_edge_t edges[MAX_EDGES];
+static wave_t wave;
+
+static uint32_t cpu_hz;
+static clock_conv_t ns_to_cycles;
+static clock_conv_t cycles_to_ns;
+static volatile uint32_t ticks;
+
+// Four pixels, GRB order
+static const uint8_t pixels[] = {
+    0x00, 0xFF, 0x00,   0xFF, 0x00, 0x00,   0x00, 0x00, 0xFF,   0x80, 0x80, 0x80,
+};
+static const uint8_t message[] = "Hello\n";
+static const uint8_t spi_bytes[] = { 0x9F, 0xA5, 0x00, 0xFF };
+
+static uint32_t ns(uint32_t n) {
+    return (uint32_t)clock_convert(&ns_to_cycles, n);
+}
+
+static uint32_t to_ns(uint32_t cycles) {
+    return (uint32_t)clock_convert(&cycles_to_ns, cycles);
+}
+
+static uint32_t bit_rate(uint32_t bits, uint32_t cycles) {
+    return cycles ? (uint32_t)clock_div_u64_u32((uint64_t)bits * cpu_hz, cycles) : 0;
+}
+
+// ---- Protocols ---------------------------------------------------------------
+
+static const char *build(proto_t p) {
+    uint32_t red = 1u << LED_PIN_RED;
+    uint32_t green = 1u << LED_PIN_GREEN;
+    uint32_t blue = 1u << LED_PIN_BLUE;
+
+    switch (p) {
+    case PROTO_WS2812:
+        wave_init(&wave, edges, MAX_EDGES, green, 0, 0);
+        wave_ws2812(&wave, LED_PIN_GREEN, pixels, sizeof(pixels),
+                    ns(WS_T0H_NS), ns(WS_T1H_NS), ns(WS_PERIOD_NS), ns(WS_RESET_NS));
+        return "ws2812 800k";
+    case PROTO_UART:
+        wave_init(&wave, edges, MAX_EDGES, red, 0, red);    // Idle high
+        wave_hold(&wave, cpu_hz / UART_BAUD);               // One idle bit first
+        wave_uart_tx(&wave, LED_PIN_RED, message, sizeof(message) - 1, cpu_hz / UART_BAUD);
+        return "uart 115200";
+    case PROTO_SPI:
+        // Chip select on blue, active low through GPIO_OUT_XOR
+        wave_init(&wave, edges, MAX_EDGES, red | green | blue, blue, 0);
+        wave_spi(&wave, LED_PIN_RED, LED_PIN_GREEN, LED_PIN_BLUE,
+                 spi_bytes, sizeof(spi_bytes), cpu_hz / SPI_HZ / 2);
+        return "spi 1M";
+    }
+    return "?";
+}
+
+// Replay RUNS times, keeping the worst edge timing seen
+static void run(proto_t p, uint32_t flags) {
+    wave_stats_t st, worst = { 0 };
+    const char *name = build(p);
+
+    worst.late_min = INT32_MAX;
+    worst.late_max = INT32_MIN;
+    for (int r = 0; r < RUNS; r++) {
+        if (!wave_play(&wave, flags, &st)) {
+            put_pad(name, 14);
+            put_str("table full\n");
+            return;
+        }
+        if (st.late_min < worst.late_min) {
+            worst.late_min = st.late_min;
+        }
+        if (st.late_max > worst.late_max) {
+            worst.late_max = st.late_max;
+        }
+        if (st.cycles > worst.cycles) {
+            worst.cycles = st.cycles;
+        }
+        worst.late_sum += st.late_sum / st.edges;
+        worst.edges = st.edges;
+        worst.nominal = st.nominal;
+    }
+
+    put_pad(name, 14);
+    put_str(flags & WAVE_KEEP_IRQS ? "on " : "off");
+    put_dec(worst.edges, 6);
+    put_dec(wave_min_gap(&wave), 8);
+    // Any overrun at the end of the burst stretches the payload
+    put_dec(bit_rate(wave.bits, wave.payload), 9);
+    put_dec(bit_rate(wave.bits, wave.payload + (worst.cycles - worst.nominal)), 9);
+    put_dec((uint32_t)worst.late_min, 6);
+    put_dec(worst.late_sum / RUNS, 6);
+    put_dec((uint32_t)worst.late_max, 7);
+    put_dec(to_ns((uint32_t)(worst.late_max - worst.late_min)), 8);
+    put_str("\n");
+}
+
+// ---- Traps -------------------------------------------------------------------
+
+void trap_dispatch(uint32_t mcause, uint32_t mepc, uint32_t mtval) {
+    if (mcause == (MCAUSE_INTERRUPT | IRQ_M_TIMER)) {
+        ticks++;
+        mtimecmp_write(0, mtime_read() + TICK_PERIOD);
+        return;
+    }
+
+    put_str("\nUnexpected trap: mcause ");
+    put_dec(mcause, 0);
+    put_str(", mepc ");
+    put_hex(mepc);
+    put_str(", mtval ");
+    put_hex(mtval);
+    put_str("\n");
+    while (1) {
+        asm volatile ("wfi");
+    }
+}
+
+int main(void) {
+    sifive_uart_init();
+    put_str("=== Task 30: GPIO Waveform Engine ===\n");
+
+    cpu_hz = clock_calibrate_cpu_hz(TIMEBASE_HZ / 100);     // 10 ms
+    clock_conv_init(&ns_to_cycles, NSEC_PER_SEC, cpu_hz);
+    clock_conv_init(&cycles_to_ns, cpu_hz, NSEC_PER_SEC);
+    put_str("rdcycle rate: ");
+    put_dec(cpu_hz, 0);
+    put_str(" Hz\n\n");
+
+    // Background interrupts that a burst has to survive
+    mtimecmp_write(0, mtime_read() + TICK_PERIOD);
+    set_csr(mie, MIP_MTIP);
+    set_csr(mstatus, MSTATUS_MIE);
+
+    put_str("                         min gap    bit rate (bps)  late (cycles)      jitter\n");
+    put_str("protocol      irq edges (cycles)   target achieved   min   avg    max    (ns)\n");
+    run(PROTO_WS2812, 0);
+    run(PROTO_UART, 0);
+    run(PROTO_SPI, 0);
+    run(PROTO_WS2812, WAVE_KEEP_IRQS);
+    run(PROTO_SPI, WAVE_KEEP_IRQS);
+
+    clear_csr(mstatus, MSTATUS_MIE);
+    put_str("\nTimer interrupts taken between bursts: ");
+    put_dec(ticks, 0);
+    put_str("\n");
+    return 0;
+}
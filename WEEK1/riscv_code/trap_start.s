@@ -0,0 +1,97 @@
+.section .text.start
+.global _start
+
+_start:
+    # Set up stack pointer
+    lui sp, %hi(_stack_top)
+    addi sp, sp, %lo(_stack_top)
+
+    # Copy initialized data from its load address (no-op when the linker
+    # script places .data in RAM directly, as virt.ld does)
+    la t0, _data_load
+    la t1, _data_start
+    la t2, _data_end
+    beq t0, t1, data_done
+data_loop:
+    bge t1, t2, data_done
+    lw t3, 0(t0)
+    sw t3, 0(t1)
+    addi t0, t0, 4
+    addi t1, t1, 4
+    j data_loop
+data_done:
+
+    # Initialize BSS section
+    la t0, _bss_start
+    la t1, _bss_end
+bss_loop:
+    bge t0, t1, bss_done
+    sw zero, 0(t0)
+    addi t0, t0, 4
+    j bss_loop
+bss_done:
+
+    # Initialize trap vector (direct mode)
+    la t0, trap_entry
+    csrw mtvec, t0
+
+    # Call main program
+    call main
+
+    # Infinite loop
+1:  j 1b
+
+.size _start, . - _start
+
+# Generic trap entry: saves all caller-saved registers (the C handler
+# may clobber any of them) and calls
+#     void trap_dispatch(uint32_t mcause, uint32_t mepc, uint32_t mtval)
+.section .text
+.balign 4
+.global trap_entry
+trap_entry:
+    addi sp, sp, -64
+    sw ra,  0(sp)
+    sw t0,  4(sp)
+    sw t1,  8(sp)
+    sw t2, 12(sp)
+    sw a0, 16(sp)
+    sw a1, 20(sp)
+    sw a2, 24(sp)
+    sw a3, 28(sp)
+    sw a4, 32(sp)
+    sw a5, 36(sp)
+    sw a6, 40(sp)
+    sw a7, 44(sp)
+    sw t3, 48(sp)
+    sw t4, 52(sp)
+    sw t5, 56(sp)
+    sw t6, 60(sp)
+
+    csrr a0, mcause
+    csrr a1, mepc
+    csrr a2, mtval
+    call trap_dispatch
+
+    lw ra,  0(sp)
+    lw t0,  4(sp)
+    lw t1,  8(sp)
+    lw t2, 12(sp)
+    lw a0, 16(sp)
+    lw a1, 20(sp)
+    lw a2, 24(sp)
+    lw a3, 28(sp)
+    lw a4, 32(sp)
+    lw a5, 36(sp)
+    lw a6, 40(sp)
+    lw a7, 44(sp)
+    lw t3, 48(sp)
+    lw t4, 52(sp)
+    lw t5, 56(sp)
+    lw t6, 60(sp)
+    addi sp, sp, 64
+
+    # Return from trap
+    mret
+
+.size trap_entry, . - trap_entry
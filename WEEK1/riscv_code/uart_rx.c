@@ -0,0 +1,200 @@
+#include <stdint.h>
+#include "uart_rx.h"
+#include "plic.h"
+#include "riscv_csr.h"
+
+#define RX_MASK (UART_RX_BUF_SIZE - 1)
+
+#define UART_REG8(addr) (*(volatile uint8_t *)(addr))
+
+// Single-producer (ISR) / single-consumer (main) ring.
+// Indices run freely; only the ISR writes rx_head, only main writes rx_tail.
+static char rx_buf[UART_RX_BUF_SIZE];
+static volatile uint32_t rx_head = 0;
+static volatile uint32_t rx_tail = 0;
+
+// Line API state (consumer side only)
+static uint32_t line_scan = 0;      // Next index to look at for '\n'
+static uint32_t line_release = 0;   // rx_tail value after the current line
+
+static volatile int rx_irq_enabled = 0;
+static int rx_echo = 0;
+static uart_rx_stats_t rx_stats;
+
+void uart_rx_init(void) {
+    // Drain anything received before we were ready
+    while (UART_REG8(UART_LSR) & UART_LSR_DR) {
+        (void)UART_REG8(UART_RBR);
+    }
+
+    UART_REG8(UART_FCR) = UART_FCR_ENABLE;
+    UART_REG8(UART_MCR) |= UART_MCR_OUT2;
+    UART_REG8(UART_IER) = UART_IER_RX;
+
+    plic_set_priority(UART0_IRQ, 1);
+    plic_enable(PLIC_CTX_M_HART0, UART0_IRQ);
+    plic_set_threshold(PLIC_CTX_M_HART0, 0);
+
+    set_csr(mie, MIP_MEIP);
+    rx_irq_enabled = 1;
+    set_csr(mstatus, MSTATUS_MIE);
+}
+
+void uart_rx_set_echo(int on) {
+    rx_echo = on;
+}
+
+// Drain the UART FIFO into the ring (called with interrupts disabled)
+void uart_rx_isr(void) {
+    uint32_t head = rx_head;
+
+    while (UART_REG8(UART_LSR) & UART_LSR_DR) {
+        char c = (char)UART_REG8(UART_RBR);
+
+        if (c == '\r') {
+            c = '\n';   // Terminals send CR for Enter
+        }
+
+        if (rx_echo) {
+            if (c == '\n') {
+                UART_REG8(UART_THR) = '\r';
+            }
+            UART_REG8(UART_THR) = (uint8_t)c;
+        }
+
+        uint32_t fill = head - rx_tail;
+        if (fill == UART_RX_BUF_SIZE) {
+            rx_stats.overruns++;
+            continue;
+        }
+
+        rx_buf[head & RX_MASK] = c;
+        head++;
+        rx_stats.received++;
+        if (fill + 1 > rx_stats.max_fill) {
+            rx_stats.max_fill = fill + 1;
+        }
+    }
+
+    asm volatile ("" ::: "memory");  // Data visible before the new head
+    rx_head = head;
+}
+
+// Sleep until rx_head moves past 'seen'. Interrupts are masked between
+// the check and wfi so an RX interrupt cannot slip in and be missed;
+// wfi still wakes up on the pending interrupt, which is taken as soon
+// as MIE is set again.
+static void uart_rx_wait(uint32_t seen) {
+    uint32_t mstatus = read_csr(mstatus);
+
+    if (!rx_irq_enabled || !(mstatus & MSTATUS_MIE)) {
+        // Polled fallback when uart_rx_init() was never called, or when
+        // the caller has interrupts masked and expects them to stay so
+        while (rx_head == seen) {
+            uart_rx_isr();
+        }
+        return;
+    }
+
+    clear_csr(mstatus, MSTATUS_MIE);
+    while (rx_head == seen) {
+        asm volatile ("wfi");
+        set_csr(mstatus, MSTATUS_MIE);
+        clear_csr(mstatus, MSTATUS_MIE);
+    }
+    set_csr(mstatus, MSTATUS_MIE);      // Was set on entry
+}
+
+int uart_rx_available(void) {
+    return (int)(rx_head - rx_tail);
+}
+
+int uart_rx_read(char *buf, int len) {
+    int n = 0;
+
+    if (len <= 0) {
+        return 0;
+    }
+
+    uint32_t tail = rx_tail;
+    if (rx_head == tail) {
+        uart_rx_wait(tail);
+    }
+
+    uint32_t head = rx_head;
+    while (n < len && tail != head) {
+        char c = rx_buf[tail & RX_MASK];
+        tail++;
+        buf[n++] = c;
+        if (c == '\n') {
+            break;
+        }
+    }
+
+    rx_tail = tail;
+    return n;
+}
+
+uint32_t uart_rx_line_get(uart_line_t *line) {
+    uint32_t tail = rx_tail;
+    uint32_t pos = line_scan;
+    uint32_t skip = 0;
+
+    // Bytes may have been consumed through uart_rx_read() meanwhile
+    if ((int32_t)(pos - tail) < 0) {
+        pos = tail;
+    }
+
+    for (;;) {
+        uint32_t head = rx_head;
+
+        while (pos != head && rx_buf[pos & RX_MASK] != '\n') {
+            pos++;
+        }
+
+        if (pos != head) {
+            skip = 1;       // Found '\n': consume it on release
+            break;
+        }
+
+        if (head - tail == UART_RX_BUF_SIZE) {
+            break;          // Ring full without a newline: hand out all of it
+        }
+
+        line_scan = pos;
+        uart_rx_wait(head);
+    }
+
+    // Describe [tail, pos) as one or two slices of the ring
+    uint32_t len = pos - tail;
+    uint32_t start = tail & RX_MASK;
+    uint32_t first = UART_RX_BUF_SIZE - start;
+
+    if (len < first) {
+        first = len;
+    }
+
+    line->data = &rx_buf[start];
+    line->len = first;
+    line->wrap_data = rx_buf;
+    line->wrap_len = len - first;
+
+    line_release = pos + skip;
+    line_scan = line_release;
+    return len;
+}
+
+void uart_rx_line_release(void) {
+    // Slots become writable for the ISR again only after this store
+    asm volatile ("" ::: "memory");
+    rx_tail = line_release;
+}
+
+void uart_rx_get_stats(uart_rx_stats_t *stats) {
+    uint32_t mstatus = read_csr(mstatus);
+    clear_csr(mstatus, MSTATUS_MIE);
+    *stats = rx_stats;
+    if (mstatus & MSTATUS_MIE) {
+        set_csr(mstatus, MSTATUS_MIE);
+    }
+}
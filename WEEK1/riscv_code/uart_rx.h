@@ -0,0 +1,70 @@
+#ifndef UART_RX_H
+#define UART_RX_H
+
+#include <stdint.h>
+#include "regmap.h"
+
+// 16550 UART on QEMU virt (registers are byte-spaced, see regmap.h)
+#define UART_BASE       NS16550_BASE
+#define UART_RBR        REG_ADDR(ns16550_rbr)   // Receive buffer (read)
+#define UART_THR        REG_ADDR(ns16550_thr)   // Transmit holding (write)
+#define UART_IER        REG_ADDR(ns16550_ier)   // Interrupt enable
+#define UART_FCR        REG_ADDR(ns16550_fcr)   // FIFO control (write)
+#define UART_MCR        REG_ADDR(ns16550_mcr)   // Modem control
+#define UART_LSR        REG_ADDR(ns16550_lsr)   // Line status
+
+#define UART_IER_RX     0x01    // Received data available interrupt
+#define UART_FCR_ENABLE 0x01    // Enable FIFOs, 1-byte RX trigger
+#define UART_MCR_OUT2   0x08    // Routes the IRQ line on PC-style boards
+#define UART_LSR_DR     0x01    // Data ready
+
+// Receive ring size (power of two)
+#define UART_RX_BUF_SIZE 256
+
+// A received line as (up to) two slices of the ring: the second slice is
+// only used when the line wraps around the end of the buffer. The '\n' is
+// not included. Valid until uart_rx_line_release().
+typedef struct {
+    const char *data;
+    uint32_t len;
+    const char *wrap_data;
+    uint32_t wrap_len;
+} uart_line_t;
+
+typedef struct {
+    uint32_t received;      // Bytes stored by the ISR
+    uint32_t overruns;      // Bytes dropped because the ring was full
+    uint32_t max_fill;      // Highest ring occupancy seen
+} uart_rx_stats_t;
+
+// Enable the RX interrupt in the UART, the PLIC and mie.MEIE.
+// The application's trap handler must call uart_rx_isr() when the PLIC
+// claim returns UART0_IRQ.
+void uart_rx_init(void);
+void uart_rx_isr(void);
+
+// Echo received characters back (terminals do not echo locally)
+void uart_rx_set_echo(int on);
+
+// Byte API (used by _read): blocks in wfi until at least one byte is
+// available, then returns up to len bytes, stopping after '\n'.
+int uart_rx_read(char *buf, int len);
+int uart_rx_available(void);
+
+// Zero-copy line API: blocks until a full line is in the ring.
+// Returns the line length (without '\n').
+uint32_t uart_rx_line_get(uart_line_t *line);
+void uart_rx_line_release(void);
+
+void uart_rx_get_stats(uart_rx_stats_t *stats);
+
+// Character i of a line, across the wrap boundary
+static inline char uart_line_at(const uart_line_t *line, uint32_t i) {
+    return (i < line->len) ? line->data[i] : line->wrap_data[i - line->len];
+}
+
+static inline uint32_t uart_line_length(const uart_line_t *line) {
+    return line->len + line->wrap_len;
+}
+
+#endif /* UART_RX_H */
@@ -0,0 +1,188 @@
+#include <stdint.h>
+#include "wave.h"
+#include "regmap.h"
+#include "riscv_csr.h"
+
+void wave_init(wave_t *w, wave_edge_t *buf, uint32_t cap,
+               uint32_t pins, uint32_t invert, uint32_t idle) {
+    w->edges = buf;
+    w->cap = cap;
+    w->count = 0;
+    w->pins = pins;
+    w->invert = invert & pins;
+    w->level = idle & pins;
+    w->now = 0;
+    w->bits = 0;
+    w->payload = 0;
+    w->overflow = 0;
+
+    // First edge puts every pin at its idle level
+    if (cap) {
+        buf[0].at = 0;
+        buf[0].level = w->level;
+        w->count = 1;
+    } else {
+        w->overflow = 1;
+    }
+}
+
+void wave_set(wave_t *w, uint32_t pins, uint32_t level) {
+    uint32_t next = (w->level & ~pins) | (level & pins & w->pins);
+    if (next == w->level) {
+        return;
+    }
+    w->level = next;
+
+    if (w->count && w->edges[w->count - 1].at == w->now) {
+        w->edges[w->count - 1].level = next;    // Same instant: one store
+        return;
+    }
+    if (w->count == w->cap) {
+        w->overflow = 1;
+        return;
+    }
+    w->edges[w->count].at = w->now;
+    w->edges[w->count].level = next;
+    w->count++;
+}
+
+// ---- Encoders ----------------------------------------------------------------
+
+void wave_ws2812(wave_t *w, uint32_t pin, const uint8_t *grb, uint32_t len,
+                 uint32_t t0h, uint32_t t1h, uint32_t period, uint32_t reset) {
+    uint32_t m = 1u << pin;
+
+    for (uint32_t i = 0; i < len; i++) {
+        for (int b = 7; b >= 0; b--) {
+            uint32_t high = (grb[i] >> b) & 1 ? t1h : t0h;
+            wave_set(w, m, m);
+            wave_hold(w, high);
+            wave_set(w, m, 0);
+            wave_hold(w, period - high);
+        }
+    }
+    wave_hold(w, reset);
+    w->bits += len * 8;
+    w->payload += len * 8 * period;
+}
+
+void wave_uart_tx(wave_t *w, uint32_t pin, const uint8_t *data, uint32_t len,
+                  uint32_t bit) {
+    uint32_t m = 1u << pin;
+
+    for (uint32_t i = 0; i < len; i++) {
+        // Start bit, 8 data bits, stop bit
+        uint32_t frame = ((uint32_t)data[i] << 1) | (1u << 9);
+        for (int b = 0; b < 10; b++) {
+            wave_set(w, m, (frame >> b) & 1 ? m : 0);
+            wave_hold(w, bit);
+        }
+    }
+    w->bits += len * 10;
+    w->payload += len * 10 * bit;
+}
+
+void wave_spi(wave_t *w, uint32_t sck, uint32_t mosi, uint32_t cs,
+              const uint8_t *data, uint32_t len, uint32_t half) {
+    uint32_t k = 1u << sck, d = 1u << mosi, s = 1u << cs;
+
+    wave_set(w, s | k, s);          // Select, clock idle low
+    wave_hold(w, half);
+    for (uint32_t i = 0; i < len; i++) {
+        for (int b = 7; b >= 0; b--) {
+            // Data changes on the falling edge, is sampled on the rising one
+            wave_set(w, k | d, (data[i] >> b) & 1 ? d : 0);
+            wave_hold(w, half);
+            wave_set(w, k, k);
+            wave_hold(w, half);
+        }
+    }
+    wave_set(w, k, 0);
+    wave_hold(w, half);
+    wave_set(w, s, 0);              // Deselect
+    wave_hold(w, half);
+    w->bits += len * 8;
+    w->payload += len * 16 * half;
+}
+
+uint32_t wave_min_gap(const wave_t *w) {
+    uint32_t gap = w->now;
+    for (uint32_t i = 1; i < w->count; i++) {
+        uint32_t g = w->edges[i].at - w->edges[i - 1].at;
+        if (g < gap) {
+            gap = g;
+        }
+    }
+    return gap;
+}
+
+// ---- Replay ------------------------------------------------------------------
+
+int wave_play(const wave_t *w, uint32_t flags, wave_stats_t *st) {
+    volatile uint32_t *out = REG_PTR(gpio_output_val);
+    const wave_edge_t *e = w->edges;
+    const wave_edge_t *stop = w->edges + w->count;
+    int32_t late_min = INT32_MAX, late_max = INT32_MIN;
+    uint32_t late_sum = 0;
+
+    if (w->overflow) {
+        return 0;
+    }
+
+    // Other pins keep their value: each edge is a single store, no RMW
+    uint32_t base = *out & ~w->pins;
+
+    // Drive the first (idle) level before touching polarity and direction.
+    // A pin that is already an output then never sits at a stale level
+    // until the first edge; if its XOR bit changes, it is wrong only
+    // between these two stores. The pin masks are only known at run time,
+    // so these go through REG_PTR, not by field.
+    *out = base | e->level;
+    volatile uint32_t *out_xor = REG_PTR(gpio_out_xor);
+    *out_xor = (*out_xor & ~w->pins) | w->invert;
+    *REG_PTR(gpio_iof_en) &= ~w->pins;
+    *REG_PTR(gpio_output_en) |= w->pins;
+
+    uint32_t mstatus = read_csr(mstatus);
+    if (!(flags & WAVE_KEEP_IRQS)) {
+        clear_csr(mstatus, MSTATUS_MIE);
+    }
+
+    uint32_t t0 = rdcycle() + WAVE_LEAD;
+
+    for (; e < stop; e++) {
+        uint32_t deadline = t0 + e->at;
+        uint32_t now;
+        do {
+            now = rdcycle();
+        } while ((int32_t)(now - deadline) < 0);
+        *out = base | e->level;
+
+        int32_t late = (int32_t)(now - deadline);
+        if (late < late_min) {
+            late_min = late;
+        }
+        if (late > late_max) {
+            late_max = late;
+        }
+        late_sum += (uint32_t)late;
+    }
+
+    // Hold the last level for its full length
+    uint32_t end = t0 + w->now;
+    while ((int32_t)(rdcycle() - end) < 0) {
+    }
+    uint32_t t1 = rdcycle();
+
+    if (mstatus & MSTATUS_MIE) {
+        set_csr(mstatus, MSTATUS_MIE);
+    }
+
+    st->edges = w->count;
+    st->nominal = w->now;
+    st->cycles = t1 - t0;
+    st->late_min = late_min;
+    st->late_max = late_max;
+    st->late_sum = late_sum;
+    return 1;
+}
@@ -0,0 +1,84 @@
+#ifndef WAVE_H
+#define WAVE_H
+
+#include <stdint.h>
+
+// Cycle-timed GPIO waveforms for bit-banged protocols.
+//
+// A protocol stream is compiled ahead of time into a table of edges: the
+// logical level of the wave's pins and the cycle offset, from the start
+// of the burst, at which it takes effect. wave_play() replays the table
+// with interrupts masked. It spins on rdcycle until each deadline, then
+// does one store of the precomputed GPIO_OUTPUT_VAL word. Deadlines are
+// absolute, so time spent between edges (including the jitter
+// bookkeeping) never accumulates into drift. Active-low pins are handled
+// once through GPIO_OUT_XOR, so the table holds logical levels only.
+//
+//   wave_init(&w, edges, 256, pins, invert, idle);
+//   wave_uart_tx(&w, LED_PIN_RED, (const uint8_t *)"Hi", 2, bit_cycles);
+//   wave_play(&w, 0, &stats);
+
+#define WAVE_KEEP_IRQS  1u          // wave_play flag: leave MIE alone
+#define WAVE_LEAD       200         // Cycles from setup to the first edge
+
+typedef struct {
+    uint32_t at;                    // Cycles after the start of the burst
+    uint32_t level;                 // Logical level of the wave's pins
+} wave_edge_t;
+
+typedef struct {
+    wave_edge_t *edges;
+    uint32_t cap;
+    uint32_t count;
+    uint32_t pins;                  // Pins the wave drives (bit mask)
+    uint32_t invert;                // Active-low pins, set in GPIO_OUT_XOR
+    uint32_t level;                 // Level at the cursor
+    uint32_t now;                   // Cursor: end of the wave so far, cycles
+    uint32_t bits;                  // Bits encoded (line bits for UART)
+    uint32_t payload;               // Cycles those bits take, nominal
+    int overflow;                   // An edge did not fit in the table
+} wave_t;
+
+typedef struct {
+    uint32_t edges;                 // Edges replayed
+    uint32_t nominal;               // Burst length from the table, cycles
+    uint32_t cycles;                // Burst length as measured
+    int32_t late_min;               // Edge issue time minus its deadline
+    int32_t late_max;
+    uint32_t late_sum;
+} wave_stats_t;
+
+// Start an empty wave on `pins` at the `idle` level (logical)
+void wave_init(wave_t *w, wave_edge_t *buf, uint32_t cap,
+               uint32_t pins, uint32_t invert, uint32_t idle);
+
+// Drive `pins` to `level` at the cursor (merged with an edge already there)
+void wave_set(wave_t *w, uint32_t pins, uint32_t level);
+
+// Move the cursor on
+static inline void wave_hold(wave_t *w, uint32_t cycles) {
+    w->now += cycles;
+}
+
+// Encoders; all timings in CPU cycles, pins as pin numbers.
+// WS2812: GRB bytes, MSB first. Each bit is high for t0h or t1h, then low
+// for the rest of `period`; `reset` low at the end latches the data.
+void wave_ws2812(wave_t *w, uint32_t pin, const uint8_t *grb, uint32_t len,
+                 uint32_t t0h, uint32_t t1h, uint32_t period, uint32_t reset);
+
+// UART TX, 8N1, LSB first, idle high
+void wave_uart_tx(wave_t *w, uint32_t pin, const uint8_t *data, uint32_t len,
+                  uint32_t bit);
+
+// SPI mode 0 (CPOL 0, CPHA 0), MSB first. `cs` is driven as logical 1
+// while selected; make it active-low by adding it to the invert mask.
+void wave_spi(wave_t *w, uint32_t sck, uint32_t mosi, uint32_t cs,
+              const uint8_t *data, uint32_t len, uint32_t half);
+
+// Smallest spacing between two edges (what the replay loop must keep up with)
+uint32_t wave_min_gap(const wave_t *w);
+
+// Replay the wave; returns 0 (and drives nothing) if it overflowed
+int wave_play(const wave_t *w, uint32_t flags, wave_stats_t *st);
+
+#endif /* WAVE_H */
@@ -0,0 +1,150 @@
+#include <stdint.h>
+#include "workq.h"
+#include "riscv_csr.h"
+
+typedef struct {
+    volatile uint32_t seq;  // == pos: free for producer, == pos + 1: full
+    work_fn_t fn;
+    uint32_t arg;
+} work_slot_t;
+
+typedef struct {
+    uint32_t head;          // Next position to claim (producers, atomic)
+    uint32_t tail;          // Next position to run (owning hart only)
+    work_slot_t slot[WORKQ_DEPTH];
+} work_ring_t;
+
+typedef struct {
+    work_ring_t ring[WORKQ_PRIORITIES];
+    workq_stats_t stats;
+} workq_hart_t;
+
+static workq_hart_t queues[WORKQ_MAX_HARTS];
+
+static inline uint32_t this_hart(void) {
+    return read_csr(mhartid);
+}
+
+void workq_init(void) {
+    for (int h = 0; h < WORKQ_MAX_HARTS; h++) {
+        for (int p = 0; p < WORKQ_PRIORITIES; p++) {
+            work_ring_t *r = &queues[h].ring[p];
+            r->head = 0;
+            r->tail = 0;
+            for (uint32_t i = 0; i < WORKQ_DEPTH; i++) {
+                r->slot[i].seq = i;
+            }
+        }
+    }
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+int workq_enqueue_on(uint32_t hart, uint32_t prio, work_fn_t fn, uint32_t arg) {
+    if (hart >= WORKQ_MAX_HARTS || prio >= WORKQ_PRIORITIES) {
+        return 0;
+    }
+
+    workq_hart_t *q = &queues[hart];
+    work_ring_t *r = &q->ring[prio];
+    uint32_t pos = __atomic_load_n(&r->head, __ATOMIC_RELAXED);
+
+    for (;;) {
+        work_slot_t *s = &r->slot[pos & (WORKQ_DEPTH - 1)];
+        int32_t dif = (int32_t)(__atomic_load_n(&s->seq, __ATOMIC_ACQUIRE) - pos);
+
+        if (dif == 0) {
+            // Slot free: claim the position (pos is refreshed on failure)
+            if (__atomic_compare_exchange_n(&r->head, &pos, pos + 1, 1,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                s->fn = fn;
+                s->arg = arg;
+                __atomic_store_n(&s->seq, pos + 1, __ATOMIC_RELEASE);
+                break;
+            }
+        } else if (dif < 0) {
+            __atomic_fetch_add(&q->stats.dropped, 1, __ATOMIC_RELAXED);
+            return 0;
+        } else {
+            pos = __atomic_load_n(&r->head, __ATOMIC_RELAXED);
+        }
+    }
+
+    uint32_t enqueued = __atomic_add_fetch(&q->stats.enqueued, 1, __ATOMIC_RELAXED);
+    uint32_t pending = enqueued - __atomic_load_n(&q->stats.executed, __ATOMIC_RELAXED);
+
+    // Atomic max: a nested ISR or another hart may be updating it too
+    uint32_t max = __atomic_load_n(&q->stats.max_pending, __ATOMIC_RELAXED);
+    while (pending > max &&
+           !__atomic_compare_exchange_n(&q->stats.max_pending, &max, pending, 1,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+    return 1;
+}
+
+int workq_enqueue(uint32_t prio, work_fn_t fn, uint32_t arg) {
+    return workq_enqueue_on(this_hart(), prio, fn, arg);
+}
+
+// Take the next item of one level, if its producer has finished writing it
+static int ring_take(work_ring_t *r, work_fn_t *fn, uint32_t *arg) {
+    work_slot_t *s = &r->slot[r->tail & (WORKQ_DEPTH - 1)];
+
+    if (__atomic_load_n(&s->seq, __ATOMIC_ACQUIRE) != r->tail + 1) {
+        return 0;
+    }
+    *fn = s->fn;
+    *arg = s->arg;
+    __atomic_store_n(&s->seq, r->tail + WORKQ_DEPTH, __ATOMIC_RELEASE);
+    r->tail++;
+    return 1;
+}
+
+uint32_t workq_run(void) {
+    workq_hart_t *q = &queues[this_hart()];
+    uint32_t ran = 0;
+    int prio = 0;
+
+    while (prio < WORKQ_PRIORITIES) {
+        work_fn_t fn;
+        uint32_t arg;
+
+        if (ring_take(&q->ring[prio], &fn, &arg)) {
+            fn(arg);
+            q->stats.executed++;
+            ran++;
+            prio = 0;   // Re-check higher levels after every item
+        } else {
+            prio++;
+        }
+    }
+    return ran;
+}
+
+uint32_t workq_pending(void) {
+    workq_hart_t *q = &queues[this_hart()];
+    uint32_t n = 0;
+
+    for (int p = 0; p < WORKQ_PRIORITIES; p++) {
+        work_ring_t *r = &q->ring[p];
+        n += __atomic_load_n(&r->head, __ATOMIC_RELAXED) - r->tail;
+    }
+    return n;
+}
+
+void workq_idle_loop(void) {
+    while (1) {
+        workq_run();
+
+        // Sleep only if nothing arrived since the last check; wfi still
+        // wakes on a pending interrupt with MIE clear
+        clear_csr(mstatus, MSTATUS_MIE);
+        if (workq_pending() == 0) {
+            asm volatile ("wfi");
+        }
+        set_csr(mstatus, MSTATUS_MIE);
+    }
+}
+
+void workq_get_stats(workq_stats_t *stats) {
+    *stats = queues[this_hart()].stats;
+}
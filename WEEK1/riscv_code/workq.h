@@ -0,0 +1,52 @@
+#ifndef WORKQ_H
+#define WORKQ_H
+
+#include <stdint.h>
+
+// Deferred work ("bottom halves"): interrupt handlers enqueue a function
+// pointer and a payload and return; workq_run() executes the items later
+// with interrupts enabled, highest priority first.
+//
+// One queue set per hart. Each priority level is a bounded lock-free ring
+// with per-slot sequence numbers, so enqueue is safe from nested ISRs and
+// from other harts; only the owning hart dequeues.
+
+#define WORKQ_MAX_HARTS     8
+#define WORKQ_PRIORITIES    4       // 0 = highest
+#define WORKQ_DEPTH         32      // Items per priority level (power of two)
+
+#define WORKQ_PRIO_HIGH     0
+#define WORKQ_PRIO_NORMAL   1
+#define WORKQ_PRIO_LOW      3
+
+typedef void (*work_fn_t)(uint32_t arg);
+
+typedef struct {
+    uint32_t enqueued;
+    uint32_t executed;
+    uint32_t dropped;       // Queue was full
+    uint32_t max_pending;   // Highest number of queued items seen
+} workq_stats_t;
+
+// Reset all queues; call once on the boot hart before interrupts are enabled
+void workq_init(void);
+
+// Queue work for the given hart (returns 0 if that level is full)
+int workq_enqueue_on(uint32_t hart, uint32_t prio, work_fn_t fn, uint32_t arg);
+
+// Queue work for the calling hart
+int workq_enqueue(uint32_t prio, work_fn_t fn, uint32_t arg);
+
+// Run queued work on the calling hart until all levels are empty; a new
+// higher-priority item is picked up before the next lower one. Call with
+// interrupts enabled. Returns the number of items run.
+uint32_t workq_run(void);
+
+// Run queued work, then sleep in wfi until an interrupt queues more.
+// Never returns.
+void workq_idle_loop(void) __attribute__((noreturn));
+
+uint32_t workq_pending(void);
+void workq_get_stats(workq_stats_t *stats);
+
+#endif /* WORKQ_H */
@@ -0,0 +1,73 @@
+#include <stdint.h>
+#include "wsdeque.h"
+
+// Indices grow without bound and wrap at 2^32; differences are signed
+
+void wsdeque_init(wsdeque_t *q) {
+    q->top = 0;
+    q->bottom = 0;
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+int wsdeque_push(wsdeque_t *q, ws_item_t item) {
+    uint32_t b = __atomic_load_n(&q->bottom, __ATOMIC_RELAXED);
+    uint32_t t = __atomic_load_n(&q->top, __ATOMIC_ACQUIRE);
+
+    if ((int32_t)(b - t) >= WSDEQUE_SIZE) {
+        return 0;
+    }
+    q->items[b & (WSDEQUE_SIZE - 1)] = item;
+
+    // Publish the item before the new bottom
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&q->bottom, b + 1, __ATOMIC_RELAXED);
+    return 1;
+}
+
+int wsdeque_pop(wsdeque_t *q, ws_item_t *item) {
+    uint32_t b = __atomic_load_n(&q->bottom, __ATOMIC_RELAXED) - 1;
+
+    // Reserve the bottom item, then look at top: the full fence orders
+    // the store before the load, so a thief either sees the reservation
+    // or we see its steal
+    __atomic_store_n(&q->bottom, b, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    uint32_t t = __atomic_load_n(&q->top, __ATOMIC_RELAXED);
+
+    if ((int32_t)(b - t) < 0) {
+        // Empty
+        __atomic_store_n(&q->bottom, b + 1, __ATOMIC_RELAXED);
+        return 0;
+    }
+
+    *item = q->items[b & (WSDEQUE_SIZE - 1)];
+    if (b != t) {
+        return 1;                   // More than one left: no race possible
+    }
+
+    // Last item: race the thieves for it
+    int won = __atomic_compare_exchange_n(&q->top, &t, t + 1, 0,
+                                          __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+    __atomic_store_n(&q->bottom, b + 1, __ATOMIC_RELAXED);
+    return won;
+}
+
+ws_result_t wsdeque_steal(wsdeque_t *q, ws_item_t *item) {
+    uint32_t t = __atomic_load_n(&q->top, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    uint32_t b = __atomic_load_n(&q->bottom, __ATOMIC_ACQUIRE);
+
+    if ((int32_t)(b - t) <= 0) {
+        return WS_EMPTY;
+    }
+
+    // Copy first: the slot cannot be reused before top moves past it, and
+    // if it has moved the CAS below fails and the copy is discarded
+    ws_item_t copy = q->items[t & (WSDEQUE_SIZE - 1)];
+    if (!__atomic_compare_exchange_n(&q->top, &t, t + 1, 0,
+                                     __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+        return WS_ABORT;
+    }
+    *item = copy;
+    return WS_OK;
+}
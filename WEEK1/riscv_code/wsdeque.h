@@ -0,0 +1,44 @@
+#ifndef WSDEQUE_H
+#define WSDEQUE_H
+
+#include <stdint.h>
+
+// Chase-Lev work-stealing deque (bounded, after Le et al., "Correct and
+// Efficient Work-Stealing for Weak Memory Models", PPoPP 2013).
+//
+// The owning hart pushes and pops at the bottom without any atomic
+// read-modify-write; other harts steal from the top with one CAS (lr/sc).
+// The only contended case is the last item, which owner and thieves
+// settle with the same CAS on top.
+
+#define WSDEQUE_SIZE    64          // Items (power of two)
+
+typedef struct {
+    uint32_t lo;                    // Iteration range [lo, hi)
+    uint32_t hi;
+} ws_item_t;
+
+typedef struct {
+    volatile uint32_t top;          // Next item to steal (thieves, CAS)
+    volatile uint32_t bottom;       // Next free slot (owner only)
+    ws_item_t items[WSDEQUE_SIZE];
+} wsdeque_t;
+
+typedef enum {
+    WS_EMPTY,
+    WS_OK,
+    WS_ABORT,                       // Lost a race, worth retrying
+} ws_result_t;
+
+void wsdeque_init(wsdeque_t *q);
+
+// Owner only: returns 0 if the deque is full
+int wsdeque_push(wsdeque_t *q, ws_item_t item);
+
+// Owner only: newest item first (LIFO keeps the working set hot)
+int wsdeque_pop(wsdeque_t *q, ws_item_t *item);
+
+// Any hart: oldest (and usually largest) item first
+ws_result_t wsdeque_steal(wsdeque_t *q, ws_item_t *item);
+
+#endif /* WSDEQUE_H */